@@ -1,118 +1,335 @@
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <new>
+#include <utility>
+#include <vector>
 #include "ArrayADTList.h"
 
 // --- Constructor & Destructor ---
 
-// Default constructor: Initializes an empty list with a dynamically allocated array of MAX_SIZE.
-template <typename DataType>
-ArrayADTList<DataType>::ArrayADTList() {
-   collection = new DataType[MAX_SIZE]; // Allocate memory for the array
+// Default constructor: Initializes an empty list with a dynamically allocated array of INITIAL_CAPACITY.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::ArrayADTList() {
+   collection = new DataType[INITIAL_CAPACITY]; // Allocate memory for the array
    size = 0; // Initialize size to 0 (empty list)
+   capacity = INITIAL_CAPACITY;
+}
+
+// Destructor: Releases the buffer, which outlives the list if a View still holds it.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::~ArrayADTList() {
+   releaseBuffer();
 }
 
 // Copy constructor: Initializes a new list as a copy of another list.
-template <typename DataType>
-ArrayADTList<DataType>::ArrayADTList(const ArrayADTList& other) {
-   collection = new DataType[MAX_SIZE]; // Allocate memory for the array
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::ArrayADTList(const ArrayADTList& other) {
+   typename StatsPolicy::Timer timer(stats, STATS_COPY);
+   stats.addAllocations(1);
+   capacity = other.size > INITIAL_CAPACITY ? other.size : INITIAL_CAPACITY;
+   collection = new DataType[capacity]; // Allocate memory for the array
    size = other.size; // Copy the size from the other list
-   for (int i = 0; i < size; ++i) {
-       collection[i] = other.collection[i]; // Copy each element from the other list
+   try {
+       copyItems(other.collection, size);
+   } catch (...) {
+       delete[] collection; // The destructor will not run, so release the buffer here
+       throw;
    }
 }
 
 // Copy assignment operator: Assigns the contents of another list to this list.
-template <typename DataType>
-ArrayADTList<DataType>& ArrayADTList<DataType>::operator=(const ArrayADTList& other) {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>& ArrayADTList<DataType, SearchPolicy, StatsPolicy>::operator=(const ArrayADTList& other) {
+   typename StatsPolicy::Timer timer(stats, STATS_COPY);
    if (this != &other) { // Check for self-assignment
-       size = other.size; // Copy the size from the other list
-       for (int i = 0; i < size; ++i) {
-           collection[i] = other.collection[i]; // Copy each element from the other list
+       if (other.size > capacity || viewed()) { // Only replace the buffer when it is too small or still in view
+           int newCapacity = other.size > capacity ? other.size : capacity;
+           DataType* replacement = new DataType[newCapacity];
+           stats.addAllocations(1);
+           releaseBuffer();
+           collection = replacement;
+           capacity = newCapacity;
        }
+       size = 0; // Nothing is valid until the copy completes
+       search.invalidate();
+       copyItems(other.collection, other.size); // Assigns over the old items, reusing the buffer
+       size = other.size;
    }
    return *this; // Return the current object for chaining
 }
 
-// --- Basic Methods ---
+// Move constructor: Takes over the other list's buffer, leaving it empty.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::ArrayADTList(ArrayADTList&& other) noexcept
+   : collection(other.collection), size(other.size), capacity(other.capacity), shared(std::move(other.shared)), search(std::move(other.search)) {
+   other.collection = nullptr; // The other list will allocate again if it is reused
+   other.size = 0;
+   other.capacity = 0;
+   other.search.invalidate();
+}
 
-// isFull: Checks if the list is full (i.e., size equals MAX_SIZE).
-template <typename DataType>
-bool ArrayADTList<DataType>::isFull() const {
-   return size == MAX_SIZE; // Return true if size equals MAX_SIZE, otherwise false
+// Move assignment operator: Releases this list's buffer and takes over the other list's.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>& ArrayADTList<DataType, SearchPolicy, StatsPolicy>::operator=(ArrayADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       releaseBuffer();
+       collection = other.collection;
+       size = other.size;
+       capacity = other.capacity;
+       shared = std::move(other.shared);
+       search = std::move(other.search);
+       other.collection = nullptr;
+       other.size = 0;
+       other.capacity = 0;
+       other.search.invalidate();
+   }
+   return *this; // Return the current object for chaining
 }
 
-// getLength: Returns the current number of elements in the list.
-template <typename DataType>
-int ArrayADTList<DataType>::getLength() const {
-   return size; // Return the current size of the list
+// swap: Exchanges buffers, sizes, and search state with another list.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::swap(ArrayADTList& other) noexcept {
+   std::swap(collection, other.collection);
+   std::swap(size, other.size);
+   std::swap(capacity, other.capacity);
+   std::swap(shared, other.shared);
+   std::swap(search, other.search);
 }
 
-template <typename DataType>
-int ArrayADTList<DataType>::binarySearch(const DataType& item) const {
-   int low = 0;
-   int high = size - 1;
+// --- Basic Methods ---
 
+// isFull: Checks if the list is full and the buffer cannot be grown any further.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::isFull() const {
+   return size == capacity && nextCapacity() == capacity; // Only the limit of the index type stops growth
+}
 
-   while (low <= high) {
-      int mid = low + (high - low) / 2;
+// getCapacity: Returns the number of slots in the underlying buffer.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::getCapacity() const {
+   return capacity;
+}
 
+// reserve: Grows the buffer so it holds at least newCapacity elements.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::reserve(int newCapacity) {
+   if (newCapacity > capacity && !reallocate(newCapacity)) {
+      throw FullError();
+   }
+}
 
-      // Check if the item is present at mid
-      if (collection[mid] == item) {
-         return mid; // Item found, return the index
-      }
+// shrinkToFit: Reallocates the buffer so its capacity matches the current size.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::shrinkToFit() {
+   if (size < capacity) {
+      reallocate(size); // A failed shrink leaves the larger buffer in place
+   }
+}
 
+// nextCapacity: Doubles the capacity, clamping to the largest representable size.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::nextCapacity() const {
+   if (capacity < INITIAL_CAPACITY) {
+      return INITIAL_CAPACITY;
+   }
+   return capacity > INT_MAX / 2 ? INT_MAX : capacity * 2;
+}
 
-      // If item is greater, ignore the left half
-      if (collection[mid] < item) {
-         low = mid + 1;
-      }
-      // If item is smaller, ignore the right half
-      else {
-         high = mid - 1;
+// ensureRoom: Grows the buffer when it is full, throwing FullError if that is not possible.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::ensureRoom() {
+   if (size == capacity && (nextCapacity() == capacity || !reallocate(nextCapacity()))) {
+      throw FullError(); // The buffer is full and could not be grown
+   }
+}
+
+// reallocate: Moves the elements into a fresh buffer of newCapacity slots, or copies them if moving could throw.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::reallocate(int newCapacity) {
+   std::unique_ptr<DataType[]> replacement(new (std::nothrow) DataType[newCapacity]); // Freed if a copy throws
+   if (replacement == nullptr) {
+      return false; // Leave the current buffer untouched
+   }
+   stats.addAllocations(1);
+   stats.addMoves(size);
+   if (viewed() || !std::is_nothrow_move_assignable<DataType>::value) {
+      std::copy(collection, collection + size, replacement.get()); // A view still reads the old buffer, or a move could throw
+   } else {
+      for (int i = 0; i < size; ++i) {
+         replacement[i] = std::move(collection[i]); // Move rather than copy each element
       }
    }
+   releaseBuffer();
+   collection = replacement.release();
+   capacity = newCapacity;
+   return true;
+}
 
+// getLength: Returns the current number of elements in the list.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::getLength() const {
+   return size; // Return the current size of the list
+}
+
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::binarySearch(const DataType& item) const {
+   const Key& key = Order::key(item);
+   int index = search.lowerBound(collection, size, key, stats); // First element not less than item
+   stats.addProbes(index < size ? 1 : 0); // The equality check below
+
+   if (index < size && Order::equal(Order::key(collection[index]), key)) {
+      return index; // Item found, return the index
+   }
 
    return -1; // Item not found
 }
 
+// lowerBound: Asks the search policy for the first position not less than item.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator ArrayADTList<DataType, SearchPolicy, StatsPolicy>::lowerBound(const DataType& item) const {
+   return Iterator(this, search.lowerBound(collection, size, Order::key(item)));
+}
+
+// upperBound: Binary searches for the first position greater than item.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator ArrayADTList<DataType, SearchPolicy, StatsPolicy>::upperBound(const DataType& item) const {
+   return Iterator(this, upperIndex(Order::key(item), 0));
+}
+
+// equalRange: Finds the lower bound, then searches only the items after it for the upper bound.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+std::pair<typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator, typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::equalRange(const DataType& item) const {
+   const Key& key = Order::key(item);
+   int lower = search.lowerBound(collection, size, key);
+   return std::make_pair(Iterator(this, lower), Iterator(this, upperIndex(key, lower)));
+}
+
+// rangeIterator: Spans from the lower bound of lo to the upper bound of hi.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+IteratorRange<typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::rangeIterator(const DataType& lo, const DataType& hi) const {
+   const Key& loKey = Order::key(lo);
+   const Key& hiKey = Order::key(hi);
+   int lower = search.lowerBound(collection, size, loKey);
+   int upper = Order::less(hiKey, loKey) ? lower : upperIndex(hiKey, lower);
+   return IteratorRange<Iterator>(Iterator(this, lower), Iterator(this, upper));
+}
+
+// upperIndex: Uses the vector kernel for naturally ordered arithmetic types and std::upper_bound otherwise.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::upperIndex(const Key& key, int first) const {
+   if constexpr (std::is_arithmetic<DataType>::value && Order::NATURAL) {
+      return first + SimdSearch::upperBound(collection + first, size - first, key);
+   } else {
+      return static_cast<int>(std::upper_bound(collection + first, collection + size, key, [](const Key& bound, const DataType& item) {
+         return Order::less(bound, Order::key(item));
+      }) - collection);
+   }
+}
+
 // makeEmpty: Resets the list to an empty state by setting size to 0.
-template <typename DataType>
-void ArrayADTList<DataType>::makeEmpty() {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::makeEmpty() {
+   if (viewed()) { // Leave the buffer to the views; the next insert allocates a new one
+      shared.reset();
+      collection = nullptr;
+      capacity = 0;
+   }
    size = 0; // Reset size to 0 (effectively making the list empty)
+   search.invalidate();
 }
 
-template <typename DataType>
-void ArrayADTList<DataType>::putItem(const DataType& item) {
+// putItem: Copies the item into its sorted position.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::putItem(const DataType& item) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   insertSorted(item);
+}
 
+// putItem: Moves the item into its sorted position.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::putItem(DataType&& item) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   insertSorted(std::move(item));
+}
 
-   if (isFull()) {
-      throw FullError();
+// emplaceItem: Builds the item from args, then moves it into its sorted position.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename... Args>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::emplaceItem(Args&&... args) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   insertSorted(DataType(std::forward<Args>(args)...));
+}
+
+// insertSorted: Shifts larger items right and places the item in the gap.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename Item>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::insertSorted(Item&& item) {
+   const DataType* address = &item;
+   if (size == capacity && std::less_equal<const DataType*>()(collection, address)
+       && std::less<const DataType*>()(address, collection + size)) {
+      // Growing frees the buffer the item lives in, so copy it out first, as std::vector does.
+      DataType held(static_cast<const DataType&>(item));
+      insertSorted(std::move(held));
+      return;
    }
 
 
-   // Start from the last element and shift elements until the correct spot is found.
+   ensureRoom(); // Grow the buffer if it is full
+   detach(); // Copy the buffer first if a view still holds it
+
+
    int i = size;
-   while (i > 0 && collection[i - 1] > item) {
-      collection[i] = collection[i - 1];
-      i--;
+   if constexpr (std::is_arithmetic<DataType>::value && Order::NATURAL) {
+      // Find the slot after any equal items with vector compares, then open it with one memmove.
+      i = SimdSearch::upperBound(collection, size, item, stats);
+      std::memmove(collection + i + 1, collection + i, (size - i) * sizeof(DataType));
+   } else {
+      // Start from the last element and shift elements until the correct spot is found.
+      while (i > 0 && Order::before(item, collection[i - 1])) {
+         collection[i] = std::move(collection[i - 1]); // Move rather than copy each shifted item
+         i--;
+      }
+      stats.addProbes(size - i + (i > 0 ? 1 : 0)); // One comparison per shifted item, plus the one that stopped the scan
    }
+   stats.addMoves(size - i);
 
 
    // Insert the new item.
-   collection[i] = item;
+   collection[i] = std::forward<Item>(item);
 
 
    size++; // Increase the size.
+   search.inserted(collection, size, i);
+}
+
+
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::getItem(const DataType& item, DataType& foundItem) const {
+   return findKey(Order::key(item), foundItem);
 }
 
+// getItem: Looks an item up by anything that converts to its key, such as a bare ID.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename KeyType>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::getItem(const KeyType& key, DataType& foundItem) const {
+   return findKey(static_cast<const Key&>(key), foundItem);
+}
 
-template <typename DataType>
-bool ArrayADTList<DataType>::getItem(const DataType& item, DataType& foundItem) const {
-   int index = binarySearch(item); // Use binary search to find the item
+// findKey: Lets the search policy locate the item with the given key.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::findKey(const Key& key, DataType& foundItem) const {
+   typename StatsPolicy::Timer timer(stats, STATS_GET);
+   const DataType* match = search.find(collection, size, key, stats); // The policy counts its own comparisons
 
 
-   if (index != -1) { // If the item is found
-      foundItem = collection[index];
+   if (match != nullptr) { // If the item is found
+      foundItem = *match;
       return true;
    }
 
@@ -121,41 +338,375 @@ bool ArrayADTList<DataType>::getItem(const DataType& item, DataType& foundItem)
 }
 
 // deleteItem: Deletes an item from the list if it exists.
-template <typename DataType>
-bool ArrayADTList<DataType>::deleteItem(const DataType& item) {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::deleteItem(const DataType& item) {
+   typename StatsPolicy::Timer timer(stats, STATS_DELETE);
    int i = binarySearch(item);
    if (i == -1) {
       return false;
    }
-   for (; i < size - 1; ++i) {
-      collection[i] = collection[i + 1];
-   }
+   detach();
+   search.erasing(collection, size, i);
+   moveRun(i, i + 1, size - i - 1); // Close the gap over the deleted item
    size--;
    return true;
 }
 
 
+// putItems: Appends a batch, sorts it unless it is already ordered, and merges it with the existing items.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename InputIterator>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::putItems(InputIterator first, InputIterator last) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   detach();
+   int oldSize = size;
+   try {
+      for (; first != last; ++first) {
+         ensureRoom();
+         collection[size++] = *first; // Append without shifting
+      }
+   } catch (...) {
+      size = oldSize; // Drop the partial batch so the list stays sorted
+      throw;
+   }
+
+   DataType* batch = collection + oldSize;
+   DataType* batchEnd = collection + size;
+   auto before = [](const DataType& a, const DataType& b) { return Order::before(a, b); };
+   if (!std::is_sorted(batch, batchEnd, before)) {
+      std::stable_sort(batch, batchEnd, before); // Stable so equal items keep their input order, as with putItem
+      stats.addMoves(batchEnd - batch);
+   }
+   if (oldSize > 0 && batch != batchEnd && before(*batch, collection[oldSize - 1])) {
+      // Existing items up to the first one the batch goes before, equal ones included, stay where they are.
+      DataType* displaced = std::upper_bound(collection, batch, *batch, before);
+      std::inplace_merge(displaced, batch, batchEnd, before); // One linear pass over both runs
+      stats.addMoves(batchEnd - displaced);
+   }
+   search.invalidate();
+}
+
+// assignRange: Replaces the contents of the list with the given batch.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename InputIterator>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::assignRange(InputIterator first, InputIterator last) {
+   makeEmpty();
+   putItems(first, last);
+}
+
+// unionWith: Merges both lists into a new buffer, moving this list's items and copying the other's.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::unionWith(const ArrayADTList& other, SetAlgebraMode mode) {
+   if (this == &other || other.size == 0) {
+      return; // Nothing to add
+   }
+   if (other.size > INT_MAX - size) {
+      throw FullError(); // The result could not be indexed
+   }
+   int newCapacity = size + other.size > INITIAL_CAPACITY ? size + other.size : INITIAL_CAPACITY;
+   std::unique_ptr<DataType[]> merged(new (std::nothrow) DataType[newCapacity]); // Freed if a comparison or copy throws
+   if (merged == nullptr) {
+      throw FullError(); // Leave the current buffer untouched
+   }
+   stats.addAllocations(1);
+
+   bool gallop = SetAlgebra::shouldGallop(mode, size, other.size);
+   // Every comparison and every copy of theirs happens in the first pass, which only notes where
+   // each run of ours goes. Ours are placed in the second pass, by move when that cannot throw
+   // and no view still reads our buffer, so a throw anywhere leaves this list unchanged.
+   std::vector<std::pair<int, int> > ourRuns; // First item of each run of ours, and where it lands in merged
+   const DataType* theirs = other.collection;
+   int i = 0, j = 0, k = 0;
+   while (i < size && j < other.size) {
+      if (Order::before(collection[i], theirs[j])) { // Take the whole run of ours that comes first
+         int run = SetAlgebra::advance<Order>(collection, i, size, theirs[j], gallop);
+         ourRuns.emplace_back(i, k);
+         k += run - i;
+         i = run;
+      } else if (Order::before(theirs[j], collection[i])) { // Take the whole run of theirs that comes first
+         int run = SetAlgebra::advance<Order>(theirs, j, other.size, collection[i], gallop);
+         std::copy(theirs + j, theirs + run, merged.get() + k);
+         k += run - j;
+         j = run;
+      } else {
+         ourRuns.emplace_back(i, k); // Held by both, so keep only ours
+         ++i;
+         ++j;
+         ++k;
+      }
+   }
+   if (i < size) {
+      ourRuns.emplace_back(i, k);
+      k += size - i;
+   }
+   std::copy(theirs + j, theirs + other.size, merged.get() + k); // Empty if ours has a tail
+   k += other.size - j;
+
+   bool keepOurs = viewed() || !std::is_nothrow_move_assignable<DataType>::value;
+   for (size_t r = 0; r < ourRuns.size(); ++r) {
+      int from = ourRuns[r].first;
+      int to = r + 1 < ourRuns.size() ? ourRuns[r + 1].first : size; // Runs of ours follow each other with no gaps
+      DataType* out = merged.get() + ourRuns[r].second;
+      if (keepOurs) {
+         std::copy(collection + from, collection + to, out); // Still only reads ours, so a throw changes nothing
+      } else {
+         std::move(collection + from, collection + to, out);
+      }
+   }
+
+   stats.addMoves(k);
+   releaseBuffer();
+   collection = merged.release();
+   size = k;
+   capacity = newCapacity;
+   search.invalidate();
+}
+
+// intersectWith: Slides every item the other list also holds down over the ones it does not.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::intersectWith(const ArrayADTList& other, SetAlgebraMode mode) {
+   if (this == &other) {
+      return; // Every item is held by both
+   }
+   detach();
+   bool gallop = SetAlgebra::shouldGallop(mode, size, other.size);
+   const DataType* theirs = other.collection;
+   int i = 0, j = 0, kept = 0;
+   while (i < size && j < other.size) {
+      if (Order::before(collection[i], theirs[j])) {
+         i = SetAlgebra::advance<Order>(collection, i, size, theirs[j], gallop); // Skip items they lack
+      } else if (Order::before(theirs[j], collection[i])) {
+         j = SetAlgebra::advance<Order>(theirs, j, other.size, collection[i], gallop);
+      } else {
+         moveRun(kept++, i++, 1);
+         ++j;
+      }
+   }
+   size = kept;
+   search.invalidate();
+}
+
+// subtract: Removes one of our items per matching item of the other list in one compaction pass.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::subtract(const ArrayADTList& other, SetAlgebraMode mode) {
+   if (this == &other) {
+      makeEmpty(); // Every item is removed
+      return;
+   }
+   removeSorted(other.collection, other.size, SetAlgebra::shouldGallop(mode, size, other.size));
+}
+
+// removeSorted: Slides the runs of items the sorted batch lacks down over the items it holds.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::removeSorted(const DataType* theirs, int count, bool gallop) {
+   detach();
+   int i = 0, j = 0, kept = 0;
+   while (i < size && j < count) {
+      if (Order::before(collection[i], theirs[j])) { // Keep the whole run of ours that they lack
+         int run = SetAlgebra::advance<Order>(collection, i, size, theirs[j], gallop);
+         moveRun(kept, i, run - i);
+         kept += run - i;
+         i = run;
+      } else if (Order::before(theirs[j], collection[i])) {
+         j = SetAlgebra::advance<Order>(theirs, j, count, collection[i], gallop);
+      } else {
+         ++i; // Drop one copy for each copy they hold
+         ++j;
+      }
+   }
+   moveRun(kept, i, size - i);
+   int removed = i - kept;
+   size -= removed;
+   if (removed > 0) {
+      search.invalidate();
+   }
+   return removed;
+}
+
+// deleteItems: Sorts the batch if needed, then removes it from the buffer in one compaction pass.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename InputIterator>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::deleteItems(InputIterator first, InputIterator last) {
+   std::vector<DataType> victims(first, last);
+   auto before = [](const DataType& a, const DataType& b) { return Order::before(a, b); };
+   if (!std::is_sorted(victims.begin(), victims.end(), before)) {
+      std::sort(victims.begin(), victims.end(), before);
+   }
+   int count = static_cast<int>(victims.size());
+   return removeSorted(victims.data(), count, SetAlgebra::shouldGallop(SET_AUTO, size, count));
+}
+
+// eraseIf: Slides each run of surviving items down over the items the predicate removes.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+template <typename Predicate>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::eraseIf(Predicate predicate) {
+   detach();
+   int kept = 0;
+   int runStart = 0; // First survivor not yet moved into place
+   for (int i = 0; i < size; ++i) {
+      if (predicate(static_cast<const DataType&>(collection[i]))) {
+         moveRun(kept, runStart, i - runStart); // Move the survivors before this victim as one block
+         kept += i - runStart;
+         runStart = i + 1;
+      }
+   }
+   moveRun(kept, runStart, size - runStart);
+   kept += size - runStart;
+   int removed = size - kept;
+   size = kept;
+   if (removed > 0) {
+      search.invalidate();
+   }
+   return removed;
+}
+
+// copyItems: Copies items to the front of the buffer, with one memcpy for trivially copyable types.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::copyItems(const DataType* items, int count) {
+   if constexpr (std::is_trivially_copyable<DataType>::value) {
+      if (count > 0) {
+         std::memcpy(static_cast<void*>(collection), items, count * sizeof(DataType));
+      }
+   } else {
+      std::copy(items, items + count, collection);
+   }
+}
+
+// moveRun: Slides a run of items down the buffer, with one memmove for trivially copyable types.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::moveRun(int to, int from, int count) {
+   if (to == from || count <= 0) {
+      return; // Already in place
+   }
+   stats.addMoves(count);
+   if constexpr (std::is_trivially_copyable<DataType>::value) {
+      std::memmove(static_cast<void*>(collection + to), collection + from, count * sizeof(DataType));
+   } else {
+      std::move(collection + from, collection + from + count, collection + to);
+   }
+}
+
+// viewed: Asks whether any View shares the buffer besides the list's own reference.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::viewed() const {
+   if (shared == nullptr) {
+      return false; // No view has ever been taken of this buffer
+   }
+   if (shared.use_count() > 1) {
+      return true;
+   }
+   std::atomic_thread_fence(std::memory_order_acquire); // The last view's reads happen before our writes
+   return false;
+}
+
+// detach: Copies the items into a buffer of the same capacity and leaves the old one to the views.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::detach(bool keepItems) {
+   if (!viewed()) {
+      return; // The buffer is ours to write
+   }
+   DataType* replacement = new (std::nothrow) DataType[capacity];
+   if (replacement == nullptr) {
+      throw FullError(); // Leave the current buffer untouched
+   }
+   stats.addAllocations(1);
+   if (keepItems) {
+      try {
+         std::copy(collection, collection + size, replacement);
+      } catch (...) {
+         delete[] replacement;
+         throw;
+      }
+      stats.addMoves(size);
+   }
+   shared.reset(); // The views keep the old buffer alive
+   collection = replacement;
+}
+
+// releaseBuffer: Deletes the buffer unless a shared pointer owns it, then drops that instead.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::releaseBuffer() {
+   if (shared != nullptr) {
+      shared.reset(); // Deletes the buffer once the last view is gone too
+   } else {
+      delete[] collection;
+   }
+}
+
+// snapshot: Hands the buffer to a shared pointer the first time, then shares it with the view.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View ArrayADTList<DataType, SearchPolicy, StatsPolicy>::snapshot() {
+   if (shared == nullptr) {
+      shared.reset(collection, std::default_delete<DataType[]>());
+   }
+   return View(shared, size);
+}
+
+// save: Writes the buffer out as a snapshot, in one block when the items are raw bytes.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::save(const std::string& path) const {
+   ListSnapshot::writeBlock(path, collection, size);
+}
+
+// load: Builds the snapshot's items in a new buffer and only then takes it over.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::load(const std::string& path) {
+   ListSnapshot::Mapping mapping(path, sizeof(DataType), SnapshotTraits<DataType>::RAW);
+   if (mapping.getCount() > INT_MAX) {
+      throw SnapshotError("Snapshot: " + path + " holds more items than a list can.");
+   }
+   ArrayADTList loaded;
+   loaded.reserve(static_cast<int>(mapping.getCount()));
+   if constexpr (SnapshotTraits<DataType>::RAW) {
+      std::memcpy(static_cast<void*>(loaded.collection), mapping.payload(), mapping.payloadBytes()); // Already sorted
+      loaded.size = static_cast<int>(mapping.getCount());
+   } else {
+      ListSnapshot::readItems<DataType>(mapping, [&loaded](DataType&& item) {
+         loaded.collection[loaded.size++] = std::move(item); // Already sorted, so append in order
+      });
+   }
+   *this = std::move(loaded); // Also drops any index the search policy built over the old contents
+}
+
+// getStats: Returns the stats policy so its contents can be read or dumped.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+const StatsPolicy& ArrayADTList<DataType, SearchPolicy, StatsPolicy>::getStats() const {
+   return stats;
+}
+
+// resetStats: Zeroes everything the stats policy has recorded.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void ArrayADTList<DataType, SearchPolicy, StatsPolicy>::resetStats() {
+   stats.reset();
+}
+
 // --- Iterator Methods ---
 
 // begin: Returns an iterator pointing to the first element in the list.
-template <typename DataType>
-typename ArrayADTList<DataType>::Iterator ArrayADTList<DataType>::begin() const {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator ArrayADTList<DataType, SearchPolicy, StatsPolicy>::begin() const {
    return Iterator(this, 0); // Create and return an iterator pointing to the first element
 }
 
 // end: Returns an iterator pointing to one past the last element in the list.
-template <typename DataType>
-typename ArrayADTList<DataType>::Iterator ArrayADTList<DataType>::end() const {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator ArrayADTList<DataType, SearchPolicy, StatsPolicy>::end() const {
    return Iterator(this, size); // Create and return an iterator pointing to one past the last element
 }
 
 // Iterator constructor: Initializes an iterator with a pointer to the list and an index.
-template <typename DataType>
-ArrayADTList<DataType>::Iterator::Iterator(const ArrayADTList<DataType>* list, int index) : list(list), index(index) {}
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator::Iterator(const ArrayADTList<DataType, SearchPolicy, StatsPolicy>* list, int index) : list(list), index(index) {}
+
+// getIndex: Returns the position the iterator refers to.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator::getIndex() const {
+   return index;
+}
 
 // Pre-increment operator: Moves the iterator to the next element in the list.
-template <typename DataType>
-typename ArrayADTList<DataType>::Iterator& ArrayADTList<DataType>::Iterator::operator++() {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+typename ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator& ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator::operator++() {
    if (index <= list->size) { // Check if the iterator is within bounds
        ++index; // Increment the index to point to the next element
    }
@@ -163,22 +714,64 @@ typename ArrayADTList<DataType>::Iterator& ArrayADTList<DataType>::Iterator::ope
 }
 
 // Inequality operator: Checks if two iterators are not equal.
-template <typename DataType>
-bool ArrayADTList<DataType>::Iterator::operator!=(const Iterator& other) const {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator::operator!=(const Iterator& other) const {
    return !(*this == other); // Return true if the iterators are not equal
 }
 
 // Equality operator: Checks if two iterators are equal..
-template <typename DataType>
-bool ArrayADTList<DataType>::Iterator::operator==(const Iterator& other) const {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator::operator==(const Iterator& other) const {
    return (this->index == other.index && this->list == other.list); // Return true if the iterators are equal
 }
 
 // Dereference operator: Returns the element at the current iterator position...
-template <typename DataType>
-const DataType& ArrayADTList<DataType>::Iterator::operator*() const {
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+const DataType& ArrayADTList<DataType, SearchPolicy, StatsPolicy>::Iterator::operator*() const {
    if (index >= list->size) { // Check if the iterator is out of bounds
        throw std::out_of_range("Dereferencing end iterator."); // Throw an exception if out of bounds
    }
    return list->collection[index]; // Return the element at the current index
 }
+
+// --- View Methods ---
+
+// View constructor: Shares the buffer and records how many items were in the list.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View::View(std::shared_ptr<const DataType> items, int size) : items(std::move(items)), size(size) {}
+
+// View default constructor: Shares nothing and holds no items.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View::View() : size(0) {}
+
+// View getLength: Returns the number of items in view.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+int ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View::getLength() const {
+   return size;
+}
+
+// View getItem: Binary searches the shared buffer for the item's key.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+bool ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View::getItem(const DataType& item, DataType& foundItem) const {
+   const Key& key = Order::key(item);
+   const DataType* match = std::lower_bound(begin(), end(), key, [](const DataType& held, const Key& bound) {
+      return Order::less(Order::key(held), bound);
+   });
+   if (match != end() && Order::equal(Order::key(*match), key)) {
+      foundItem = *match;
+      return true;
+   }
+   return false; // Item not found
+}
+
+// View begin: Returns a pointer to the first item in view.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+const DataType* ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View::begin() const {
+   return items.get();
+}
+
+// View end: Returns a pointer past the last item in view.
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+const DataType* ArrayADTList<DataType, SearchPolicy, StatsPolicy>::View::end() const {
+   return items.get() + size;
+}
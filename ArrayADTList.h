@@ -1,26 +1,147 @@
 #ifndef ARRAY_ADT_LIST_H
 #define ARRAY_ADT_LIST_H
 
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include "IteratorRange.h"
+#include "ListSnapshot.h"
+#include "ListStats.h"
+#include "SearchPolicies.h"
+#include "SetAlgebra.h"
 
-template <typename DataType>
+/**
+ * A sorted, array-backed implementation of an Abstract Data Type (ADT) List.
+ *
+ * The list is sorted by the ordering policy its search policy names (see ListOrdering.h), so
+ * giving the search policy a KeyOrder sorts and searches by a key instead of whole items:
+ *   ArrayADTList<Customer, BinarySearchPolicy<Customer, KeyOrder<Customer, KeyFrom<&Customer::getId> > > >
+ *
+ * @param DataType The type of data stored in the list.
+ * @param SearchPolicy How getItem and deleteItem locate items, and what they are sorted by; see SearchPolicies.h.
+ * @param StatsPolicy What the hot paths record; NoStats by default, see ListStats.h.
+ */
+template <typename DataType, typename SearchPolicy = DefaultSearchPolicy<DataType>, typename StatsPolicy = NoStats>
 class ArrayADTList {
 private:
-   static const int MAX_SIZE = 100;
+   static const int INITIAL_CAPACITY = 100;
    DataType* collection;
    int size;
+   int capacity;
+   std::shared_ptr<DataType> shared; // Owns the buffer in place of the list once a View has been taken of it
+   SearchPolicy search; // Locates items and owns any index built over the buffer
+   [[no_unique_address]] mutable StatsPolicy stats; // Updated by const lookups too; takes no space when empty
+
+   /**
+    * Computes the capacity the buffer grows to when it runs out of room.
+    * @return The next geometric capacity, or the current one if it cannot grow further.
+    */
+   int nextCapacity() const;
+
+   /**
+    * Moves the current elements into a newly allocated buffer.
+    * @param newCapacity The number of slots in the replacement buffer.
+    * @return true if the buffer was replaced, false if the allocation failed.
+    */
+   bool reallocate(int newCapacity);
+
+   /**
+    * Makes room for one more element, growing the buffer if it is full.
+    * @throw FullError if the buffer is full and cannot be grown.
+    */
+   void ensureRoom();
+
+   /**
+    * Shifts larger items right by moving them and places the new item in the gap.
+    * @param item The item to insert, copied or moved depending on how it was passed.
+    * @throw FullError if the buffer is full and cannot be grown.
+    */
+   template <typename Item>
+   void insertSorted(Item&& item);
+
+   /**
+    * Finds the first position in [first, size) whose key is greater than the given key.
+    * @param key The key to compare against.
+    * @param first The position to start searching from.
+    * @return The position found, or size if there is none.
+    */
+   int upperIndex(const typename SearchPolicy::Order::Key& key, int first) const;
+
+   /**
+    * Looks for an item by its key, timing the lookup as a getItem.
+    * @param key The key of the item being searched for.
+    * @param foundItem The retrieved item if found.
+    * @return true if an item with that key exists in the list, otherwise false.
+    */
+   bool findKey(const typename SearchPolicy::Order::Key& key, DataType& foundItem) const;
+
+   /**
+    * Moves a run of items to an earlier position in the buffer, keeping their order.
+    * @param to The position the run moves to; no greater than from.
+    * @param from The position of the first item in the run.
+    * @param count The number of items in the run.
+    */
+   void moveRun(int to, int from, int count);
+
+   /**
+    * Copies items over the front of the buffer, which must already hold at least count slots.
+    * @param items The items to copy.
+    * @param count The number of items.
+    */
+   void copyItems(const DataType* items, int count);
+
+   /**
+    * Removes one item for each matching item of a sorted sequence, compacting in one pass.
+    * @param theirs The items to remove, in sorted order.
+    * @param count The number of items to remove.
+    * @param gallop True to skip runs with an exponential search; see SetAlgebra.h.
+    * @return The number of items removed.
+    */
+   int removeSorted(const DataType* theirs, int count, bool gallop);
+
+   /**
+    * Checks whether a View other than the list itself still holds the buffer.
+    * @return true if the buffer must not be written in place.
+    */
+   bool viewed() const;
+
+   /**
+    * Gives the list a buffer of its own if a View still holds the current one.
+    * @param keepItems false when the caller overwrites every item anyway, so nothing is copied.
+    * @throw FullError if the new buffer cannot be allocated; the list is left unchanged.
+    */
+   void detach(bool keepItems = true);
+
+   /**
+    * Deletes the buffer, or drops the list's share of it if a View has been taken.
+    */
+   void releaseBuffer();
 
 public:
+   typedef typename SearchPolicy::Order Order; // What the items are sorted by
+   typedef typename Order::Key Key;
+
    /**
     * Nested iterator class for traversing the ArrayADTList.
     */
    class Iterator;
 
+   /**
+    * Read-only view of the list's contents at the moment snapshot() was called.
+    */
+   class View;
+
    /**
     * Constructs an empty ArrayADTList.
     */
    ArrayADTList();
 
+   /**
+    * Destroys the list and releases its buffer.
+    */
+   ~ArrayADTList();
+
    /**
     * Copy constructor that initializes a new list as a duplicate of an existing one.
     * @param other The list to duplicate.
@@ -29,17 +150,56 @@ public:
 
    /**
     * Overloaded assignment operator to copy the contents of one list to another.
+    * The existing buffer is reused whenever it is large enough.
     * @param other The list to copy from.
     * @return A reference to the current list after assignment.
     */
    ArrayADTList& operator=(const ArrayADTList& other);
 
    /**
-    * Determines whether the list has reached its maximum capacity.
-    * @return true if the list is full, false otherwise.
+    * Move constructor that takes over another list's buffer without copying any items.
+    * @param other The list to take the contents of; it is left empty.
+    */
+   ArrayADTList(ArrayADTList&& other) noexcept;
+
+   /**
+    * Move assignment operator that takes over another list's buffer without copying any items.
+    * @param other The list to take the contents of; it is left empty.
+    * @return A reference to the current list after assignment.
+    */
+   ArrayADTList& operator=(ArrayADTList&& other) noexcept;
+
+   /**
+    * Exchanges the contents of this list with another in constant time.
+    * @param other The list to swap with.
+    */
+   void swap(ArrayADTList& other) noexcept;
+
+   /**
+    * Determines whether the list is unable to accept another item. Only the index limit counts;
+    * an allocation that fails while growing is reported by putItem throwing FullError.
+    * @return true if the buffer is full and already at the largest capacity, false otherwise.
     */
    bool isFull() const;
 
+   /**
+    * Retrieves the number of elements the list can hold before it must grow.
+    * @return The capacity of the underlying buffer.
+    */
+   int getCapacity() const;
+
+   /**
+    * Ensures the list can hold at least the given number of elements without growing.
+    * @param newCapacity The minimum capacity to allocate.
+    * @throw FullError if the buffer cannot be allocated.
+    */
+   void reserve(int newCapacity);
+
+   /**
+    * Releases unused capacity so the buffer holds exactly the current elements.
+    */
+   void shrinkToFit();
+
    /**
     * Retrieves the number of elements currently stored in the list.
     * @return The total number of elements in the list.
@@ -54,17 +214,124 @@ public:
    /**
     * Inserts a new item into the list.
     * @param item The item to be added.
-    * @throw std::out_of_range if the list has reached its maximum capacity.
+    * @throw FullError if the buffer is full and cannot be grown.
     */
    void putItem(const DataType& item);
 
    /**
-    * Performs a binary search to locate the specified item in the list.
+    * Inserts a new item into the list, moving it into place instead of copying it.
+    * @param item The item to be added.
+    * @throw FullError if the buffer is full and cannot be grown.
+    */
+   void putItem(DataType&& item);
+
+   /**
+    * Constructs a new item from the given arguments and inserts it into the list.
+    * @param args The arguments forwarded to the DataType constructor.
+    * @throw FullError if the buffer is full and cannot be grown.
+    */
+   template <typename... Args>
+   void emplaceItem(Args&&... args);
+
+   /**
+    * Inserts a batch of items, sorting the batch once and merging it with the current contents.
+    * Input that is already in order skips the sort entirely.
+    * @param first Iterator to the first item to insert.
+    * @param last Iterator past the last item to insert.
+    * @throw FullError if the buffer cannot be grown; the list is left unchanged.
+    */
+   template <typename InputIterator>
+   void putItems(InputIterator first, InputIterator last);
+
+   /**
+    * Replaces the contents of the list with a batch of items.
+    * @param first Iterator to the first item to store.
+    * @param last Iterator past the last item to store.
+    * @throw FullError if the buffer cannot be grown.
+    */
+   template <typename InputIterator>
+   void assignRange(InputIterator first, InputIterator last);
+
+   /**
+    * Adds every item of another sorted list that this list does not already hold, in one pass.
+    * Duplicates follow std::set_union: an item held m and n times ends up max(m, n) times.
+    * @param other The list to take items from; it is not changed.
+    * @param mode Whether to merge item by item or gallop over long runs; see SetAlgebra.h.
+    * @throw FullError if the combined buffer cannot be allocated. The list is also left unchanged
+    * if a comparison or a copy throws: every comparison and copy of the other list's items comes
+    * first, and this list's items are moved in last, only when that cannot throw.
+    */
+   void unionWith(const ArrayADTList& other, SetAlgebraMode mode = SET_AUTO);
+
+   /**
+    * Keeps only the items that another sorted list also holds, compacting in place in one pass.
+    * Duplicates follow std::set_intersection: an item held m and n times is kept min(m, n) times.
+    * @param other The list to compare against; it is not changed.
+    * @param mode Whether to merge item by item or gallop over long runs; see SetAlgebra.h.
+    */
+   void intersectWith(const ArrayADTList& other, SetAlgebraMode mode = SET_AUTO);
+
+   /**
+    * Removes the items that another sorted list holds, compacting in place in one pass.
+    * Duplicates follow std::set_difference: an item held m and n times is kept max(m - n, 0) times.
+    * @param other The list of items to remove; it is not changed.
+    * @param mode Whether to merge item by item or gallop over long runs; see SetAlgebra.h.
+    */
+   void subtract(const ArrayADTList& other, SetAlgebraMode mode = SET_AUTO);
+
+   /**
+    * Writes the sorted contents to a binary snapshot; see ListSnapshot.h for the format.
+    * Trivially copyable items are written as the raw buffer in a single write.
+    * @param path The file to create or replace.
+    * @throw SnapshotError if the file cannot be written.
+    */
+   void save(const std::string& path) const;
+
+   /**
+    * Replaces the contents of the list with a snapshot written by save(), without sorting.
+    * Trivially copyable items are copied into the buffer in a single block.
+    * @param path The snapshot file.
+    * @throw SnapshotError if the file is not a valid snapshot of DataType; the list is left unchanged.
+    * @throw FullError if the buffer cannot be allocated; the list is left unchanged.
+    */
+   void load(const std::string& path);
+
+   /**
+    * Locates the specified item in the list using the configured search policy.
     * @param item The item being searched for.
     * @return The index of the item if found; otherwise, -1.
     */
    int binarySearch(const DataType& item) const;
 
+   /**
+    * Finds the first item that is not less than the given item, in O(log n).
+    * @param item The item to compare against.
+    * @return An iterator at that item, or end() if every item is less.
+    */
+   Iterator lowerBound(const DataType& item) const;
+
+   /**
+    * Finds the first item that is greater than the given item, in O(log n).
+    * @param item The item to compare against.
+    * @return An iterator at that item, or end() if no item is greater.
+    */
+   Iterator upperBound(const DataType& item) const;
+
+   /**
+    * Finds every item equal to the given item, in O(log n).
+    * @param item The item to compare against.
+    * @return The lowerBound and upperBound of item; they are equal if item is absent.
+    */
+   std::pair<Iterator, Iterator> equalRange(const DataType& item) const;
+
+   /**
+    * Provides the items between two bounds, inclusive, without copying them.
+    * @param lo The smallest item to include.
+    * @param hi The largest item to include.
+    * @return A range that can be used in a range-based for loop; empty if hi is less than lo.
+    */
+   IteratorRange<Iterator> rangeIterator(const DataType& lo, const DataType& hi) const;
+
    /**
     * Looks for an item in the list.
     * @param item The target item to find.
@@ -73,6 +340,15 @@ public:
     */
    bool getItem(const DataType& item, DataType& foundItem) const;
 
+   /**
+    * Looks for an item by its key alone, so a list ordered by ID can be searched with just the ID.
+    * @param key Anything that converts to Key.
+    * @param foundItem The retrieved item if found.
+    * @return true if an item with that key exists in the list, otherwise false.
+    */
+   template <typename KeyType>
+   bool getItem(const KeyType& key, DataType& foundItem) const;
+
    /**
     * Removes an item from the list if it exists.
     * @param item The item to be removed.
@@ -80,6 +356,45 @@ public:
     */
    bool deleteItem(const DataType& item);
 
+   /**
+    * Removes one copy of each item in a batch, compacting the survivors in a single pass
+    * instead of shifting the tail once per item. The batch is sorted first if it is not in order.
+    * @param first Iterator to the first item to remove.
+    * @param last Iterator past the last item to remove.
+    * @return The number of items removed; items not in the list are ignored.
+    */
+   template <typename InputIterator>
+   int deleteItems(InputIterator first, InputIterator last);
+
+   /**
+    * Removes every item the predicate accepts, compacting the survivors in a single pass.
+    * @param predicate Called once per item, in order, with a const reference to it.
+    * @return The number of items removed.
+    */
+   template <typename Predicate>
+   int eraseIf(Predicate predicate);
+
+   /**
+    * Takes a read-only view of the current contents in O(1), without copying any items.
+    * The view shares the buffer; the first change to the list afterwards copies the buffer
+    * (copy-on-write), so the view never sees it. Once every view is gone the list writes in
+    * place again. Views may be read and released on other threads while the list changes.
+    * @return A view of the items as they are now.
+    * @throw FullError from the first later change if the buffer cannot be copied.
+    */
+   View snapshot();
+
+   /**
+    * Provides the statistics recorded by the stats policy.
+    * @return The policy, whose toJson() formats everything it has recorded.
+    */
+   const StatsPolicy& getStats() const;
+
+   /**
+    * Sets the recorded statistics back to zero.
+    */
+   void resetStats();
+
    /**
     * Provides an iterator pointing to the first element of the list.
     * @return An iterator at the beginning of the list.
@@ -94,7 +409,7 @@ public:
 
    class Iterator {
    private:
-       const ArrayADTList<DataType>* list;
+       const ArrayADTList* list;
        int index;
 
    public:
@@ -103,7 +418,7 @@ public:
         * @param list The list being traversed.
         * @param index The current position within the list.
         */
-       Iterator(const ArrayADTList<DataType>* list, int index);
+       Iterator(const ArrayADTList* list, int index);
 
        /**
         * Moves the iterator to the next item in the list.
@@ -131,13 +446,66 @@ public:
         * @throw std::out_of_range if accessing beyond the list’s boundaries.
         */
        const DataType& operator*() const;
+
+       /**
+        * Retrieves the position the iterator refers to.
+        * @return The index of the current item, or the length of the list at end().
+        */
+       int getIndex() const;
+   };
+
+   class View {
+   private:
+       std::shared_ptr<const DataType> items; // Keeps the shared buffer alive
+       int size;
+
+       /**
+        * Constructs a view of the first size items of a shared buffer.
+        * @param items The buffer.
+        * @param size The number of items in view.
+        */
+       View(std::shared_ptr<const DataType> items, int size);
+
+       friend class ArrayADTList;
+
+   public:
+       /**
+        * Constructs an empty view.
+        */
+       View();
+
+       /**
+        * Retrieves the number of items in view.
+        * @return The length of the list when the view was taken.
+        */
+       int getLength() const;
+
+       /**
+        * Binary searches the view for an item.
+        * @param item The target item to find.
+        * @param foundItem The retrieved item if found.
+        * @return true if the item was in the list when the view was taken, otherwise false.
+        */
+       bool getItem(const DataType& item, DataType& foundItem) const;
+
+       /**
+        * Provides a pointer to the first item, for range-based for loops and the std algorithms.
+        * @return The start of the sorted items.
+        */
+       const DataType* begin() const;
+
+       /**
+        * Provides a pointer past the last item.
+        * @return The end of the sorted items.
+        */
+       const DataType* end() const;
    };
 
    class FullError {
    public:
        /**
-        * Retrieves an error message when the list is full.
-        * @return A string indicating the list has reached capacity.
+        * Retrieves an error message when the list cannot grow.
+        * @return A string indicating the buffer could not be allocated.
         */
        char const *message() { return "List is full."; }
    };
@@ -1,6 +1,8 @@
 #include <iostream>
-#include <fstream>
+#include <iterator>
+#include <vector>
 #include "ArrayADTList.h"
+#include "MappedRecordReader.h"
 #include "Customer.h"
 
 // Function prototypes
@@ -26,24 +28,21 @@ int main() {
 
 // Loads customer data from a file into the provided customer list
 void loadCustomersIntoList(const std::string& filename, ArrayADTList<Customer>& customerList, int maxCustomers) {
-   std::ifstream file(filename); // Open the file for reading
+   MappedRecordReader file(filename); // Map the file for reading
 
-   if (!file) { // Check if the file was successfully opened..
+   if (!file.isOpen()) { // Check if the file was successfully opened..
        std::cerr << "Error: Unable to open file!" << std::endl;
        return;
    }
 
-   std::string line;
-   std::getline(file, line); // Ignore the header line in the file
+   std::vector<Customer> customers;
+   std::string scratch; // Reused by every record that has to be copied out of the mapping
+   file.forEachRecord([&customers, &scratch](std::string_view line) { // Visit each line after the header
+       customers.push_back(MappedRecordReader::makeItem<Customer>(line, scratch)); // Create a Customer object from the line
+   }, maxCustomers);
 
-   int count = 0;
-   while (std::getline(file, line) && count < maxCustomers) { // Read each line until maxCustomers is reached
-       Customer customer(line); // Create a Customer object from the line
-       customerList.putItem(customer); // Add the customer to the list
-       count++; // Increment the count of loaded customers
-   }
-
-   file.close(); // Close the file
+   customerList.putItems(std::make_move_iterator(customers.begin()), // Sort and merge the whole batch at once,
+                         std::make_move_iterator(customers.end()));   // moving each customer into the list
 }
 
 // Demonstrates the functionality of ArrayADTList using integers
@@ -0,0 +1,678 @@
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "BTreeADTList.h"
+#include "SearchPolicies.h"
+
+// Constructor: Initializes an empty list with no nodes
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>::BTreeADTList()
+   : root(nullptr), head(nullptr), height(0), size(0) {}
+
+// Destructor: Releases every node
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>::~BTreeADTList() {
+   freeNode(root, height);
+}
+
+// Copy Constructor: Creates a deep copy of another list
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>::BTreeADTList(const BTreeADTList& other)
+   : root(nullptr), head(nullptr), height(0), size(0) {
+   deepCopy(other);
+}
+
+// Assignment Operator: Assigns the contents of another list to this list
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>& BTreeADTList<DataType, LeafCapacity, InnerFanout>::operator=(const BTreeADTList& other) {
+   if (this != &other) { // Check for self-assignment
+       deepCopy(other);
+   }
+   return *this;
+}
+
+// Move Constructor: Takes over the other list's nodes
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>::BTreeADTList(BTreeADTList&& other) noexcept
+   : root(other.root), head(other.head), height(other.height), size(other.size) {
+   other.root = nullptr; // Leave the other list empty
+   other.head = nullptr;
+   other.height = 0;
+   other.size = 0;
+}
+
+// Move Assignment Operator: Releases this list's nodes and takes over the other list's
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>& BTreeADTList<DataType, LeafCapacity, InnerFanout>::operator=(BTreeADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       BTreeADTList taken(std::move(other));
+       swap(taken); // The old nodes are released when taken goes out of scope
+   }
+   return *this;
+}
+
+// Swap: Exchanges the nodes of this list with another list
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::swap(BTreeADTList& other) noexcept {
+   std::swap(root, other.root);
+   std::swap(head, other.head);
+   std::swap(height, other.height);
+   std::swap(size, other.size);
+}
+
+// Get length: Returns the number of items in the list
+template <class DataType, int LeafCapacity, int InnerFanout>
+int BTreeADTList<DataType, LeafCapacity, InnerFanout>::getLength() const {
+   return size;
+}
+
+// Get height: Returns the number of inner levels above the leaves
+template <class DataType, int LeafCapacity, int InnerFanout>
+int BTreeADTList<DataType, LeafCapacity, InnerFanout>::getHeight() const {
+   return height;
+}
+
+// Insert item to the list: Copies the item into place
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::putItem(const DataType& item) {
+   insertItem(item);
+}
+
+// Insert item to the list: Moves the item into place
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::putItem(DataType&& item) {
+   insertItem(std::move(item));
+}
+
+// Emplace item: Builds the item from args, then moves it into place
+template <class DataType, int LeafCapacity, int InnerFanout>
+template <typename... Args>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::emplaceItem(Args&&... args) {
+   insertItem(DataType(std::forward<Args>(args)...));
+}
+
+// Insert items: Merges a large batch with the current items into a new tree, or inserts a small one item by item
+template <class DataType, int LeafCapacity, int InnerFanout>
+template <typename InputIterator>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::putItems(InputIterator first, InputIterator last) {
+   std::vector<DataType> batch(first, last);
+   if (!std::is_sorted(batch.begin(), batch.end())) {
+       std::stable_sort(batch.begin(), batch.end()); // Stable, so equal items keep the order given
+   }
+   int count = static_cast<int>(batch.size());
+   if (count * 8LL < size) { // Rebuilding would cost more than count descents
+       for (int i = 0; i < count; ++i) {
+           insertItem(std::move(batch[i]));
+       }
+       return;
+   }
+
+   Leaf* leaf = head; // The next current item, ahead of any equal batch item
+   int index = 0;
+   int next = 0;      // The next batch item
+   build(size + count, [&](DataType& slot) {
+       if (next == count || (leaf != nullptr && !(batch[next] < leaf->items[index]))) {
+           take(slot, leaf->items[index]);
+           if (++index == leaf->count) {
+               leaf = leaf->next;
+               index = 0;
+           }
+       } else {
+           slot = std::move(batch[next++]);
+       }
+   });
+}
+
+// Retrieve an item: Descends to the first item not less than item and compares it
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::getItem(const DataType& item, DataType& found_item) const {
+   Leaf* leaf;
+   int index;
+   locate(item, leaf, index);
+   if (leaf != nullptr && leaf->items[index] == item) {
+       found_item = leaf->items[index];
+       return true;
+   }
+   return false;
+}
+
+// Make list empty: Releases every node
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::makeEmpty() {
+   freeNode(root, height);
+   root = nullptr;
+   head = nullptr;
+   height = 0;
+   size = 0;
+}
+
+// Delete an item: Removes one copy, then drops a root left with a single child or no items
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::deleteItem(const DataType& item) {
+   if (root == nullptr || !eraseFrom(root, height, item)) {
+       return false;
+   }
+   size--;
+   if (height > 0 && root->count == 1) { // The root's children were merged into one
+       Inner* old = static_cast<Inner*>(root);
+       root = old->children[0];
+       height--;
+       delete old;
+   } else if (height == 0 && root->count == 0) {
+       delete static_cast<Leaf*>(root);
+       root = nullptr;
+       head = nullptr;
+   }
+   return true;
+}
+
+// Delete items: Removes a large batch in one merge pass over the leaves, or a small one item by item
+template <class DataType, int LeafCapacity, int InnerFanout>
+template <typename InputIterator>
+int BTreeADTList<DataType, LeafCapacity, InnerFanout>::deleteItems(InputIterator first, InputIterator last) {
+   std::vector<DataType> victims(first, last);
+   if (!std::is_sorted(victims.begin(), victims.end())) {
+       std::sort(victims.begin(), victims.end());
+   }
+   int count = static_cast<int>(victims.size());
+   int removed = 0;
+   if (count * 8LL < size) { // Rebuilding would cost more than count descents
+       for (int i = 0; i < count; ++i) {
+           removed += deleteItem(victims[i]) ? 1 : 0;
+       }
+       return removed;
+   }
+
+   std::vector<char> doomed(size, 0);
+   int position = 0;
+   int next = 0; // The next victim not yet matched
+   for (const Leaf* leaf = head; leaf != nullptr && next < count; leaf = leaf->next) {
+       for (int i = 0; i < leaf->count && next < count; ++i, ++position) {
+           while (next < count && victims[next] < leaf->items[i]) {
+               ++next; // Not in the list
+           }
+           if (next < count && !(leaf->items[i] < victims[next])) {
+               doomed[position] = 1;
+               ++next;
+               ++removed;
+           }
+       }
+   }
+   return removed == 0 ? 0 : compact(doomed, removed);
+}
+
+// Erase if: Marks every item the predicate accepts, then rebuilds without them
+template <class DataType, int LeafCapacity, int InnerFanout>
+template <typename Predicate>
+int BTreeADTList<DataType, LeafCapacity, InnerFanout>::eraseIf(Predicate predicate) {
+   std::vector<char> doomed(size, 0);
+   int position = 0;
+   int removed = 0;
+   for (const Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+       for (int i = 0; i < leaf->count; ++i, ++position) {
+           if (predicate(leaf->items[i])) {
+               doomed[position] = 1;
+               ++removed;
+           }
+       }
+   }
+   return removed == 0 ? 0 : compact(doomed, removed);
+}
+
+// Check if list is full: Always returns false since nodes are allocated on demand
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::isFull() const {
+   return false;
+}
+
+// Lower bound: Returns an iterator at the first item not less than item
+template <class DataType, int LeafCapacity, int InnerFanout>
+typename BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator BTreeADTList<DataType, LeafCapacity, InnerFanout>::lowerBound(const DataType& item) const {
+   Leaf* leaf;
+   int index;
+   locate(item, leaf, index);
+   return Iterator(this, leaf, index);
+}
+
+// Locate: Follows the first child whose separator is not less than item, then steps to the next leaf if this one ends first
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::locate(const DataType& item, Leaf*& leaf, int& index) const {
+   leaf = nullptr;
+   index = 0;
+   if (root == nullptr) {
+       return;
+   }
+   Node* node = root;
+   for (int level = height; level > 0; --level) {
+       const Inner* inner = static_cast<const Inner*>(node);
+       int child = BranchlessSearchPolicy<DataType>().lowerBound(inner->keys, inner->count - 1, item);
+       node = inner->children[child];
+   }
+   leaf = static_cast<Leaf*>(node);
+   index = BranchlessSearchPolicy<DataType>().lowerBound(leaf->items, leaf->count, item);
+   if (index == leaf->count) { // Every item here is less, so the answer starts the next leaf
+       leaf = leaf->next;
+       index = 0;
+   }
+}
+
+// Insert item: Splits any full node on the path first, so the leaf always has room
+template <class DataType, int LeafCapacity, int InnerFanout>
+template <typename Item>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::insertItem(Item&& item) {
+   if (root == nullptr) {
+       Leaf* leaf = new Leaf;
+       leaf->count = 0;
+       leaf->next = nullptr;
+       root = leaf;
+       head = leaf;
+   }
+   if (root->count == (height == 0 ? LeafCapacity : InnerFanout)) { // Grow a new root above the full one
+       if (height == 0 && holds(static_cast<const Leaf*>(root), item)) {
+           DataType held(static_cast<const DataType&>(item)); // Splitting moves the item, so copy it out first
+           insertItem(std::move(held));
+           return;
+       }
+       Inner* top = new Inner;
+       top->count = 1;
+       top->children[0] = root;
+       try {
+           splitChild(top, 0, height);
+       } catch (...) {
+           delete top;
+           throw;
+       }
+       root = top;
+       height++;
+   }
+
+   Node* node = root;
+   for (int level = height; level > 0; --level) {
+       Inner* inner = static_cast<Inner*>(node);
+       int child = static_cast<int>(std::upper_bound(inner->keys, inner->keys + inner->count - 1, item) - inner->keys);
+       if (inner->children[child]->count == (level == 1 ? LeafCapacity : InnerFanout)) {
+           if (level == 1 && holds(static_cast<const Leaf*>(inner->children[child]), item)) {
+               DataType held(static_cast<const DataType&>(item)); // Splitting moves the item, so copy it out first
+               insertItem(std::move(held));
+               return;
+           }
+           splitChild(inner, child, level - 1);
+           if (!(item < inner->keys[child])) { // The item belongs in the new right half
+               child++;
+           }
+       }
+       node = inner->children[child];
+   }
+
+   Leaf* leaf = static_cast<Leaf*>(node);
+   int index = static_cast<int>(std::upper_bound(leaf->items, leaf->items + leaf->count, item) - leaf->items); // After equal items
+   for (int i = leaf->count; i > index; --i) {
+       leaf->items[i] = std::move(leaf->items[i - 1]);
+   }
+   leaf->items[index] = std::forward<Item>(item);
+   leaf->count++;
+   size++;
+}
+
+// Holds: Compares addresses, since a leaf's items are the only storage callers can reference
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::holds(const Leaf* leaf, const DataType& item) {
+   return std::less_equal<const DataType*>()(leaf->items, &item) && std::less<const DataType*>()(&item, leaf->items + LeafCapacity);
+}
+
+// Split child: Moves the upper half of a full child to a new sibling and adds the sibling to the parent
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::splitChild(Inner* parent, int index, int level) {
+   Node* sibling;
+   DataType separator;
+   if (level == 0) {
+       Leaf* left = static_cast<Leaf*>(parent->children[index]);
+       Leaf* right = new Leaf;
+       int keep = LeafCapacity / 2;
+       right->count = LeafCapacity - keep;
+       for (int i = 0; i < right->count; ++i) {
+           right->items[i] = std::move(left->items[keep + i]);
+       }
+       left->count = keep;
+       right->next = left->next;
+       left->next = right;
+       separator = right->items[0];
+       sibling = right;
+   } else {
+       Inner* left = static_cast<Inner*>(parent->children[index]);
+       Inner* right = new Inner;
+       int keep = InnerFanout / 2;
+       right->count = InnerFanout - keep;
+       for (int i = 0; i < right->count; ++i) {
+           right->children[i] = left->children[keep + i];
+       }
+       for (int i = 0; i < right->count - 1; ++i) {
+           right->keys[i] = std::move(left->keys[keep + i]);
+       }
+       separator = std::move(left->keys[keep - 1]); // Moves up rather than staying in either half
+       left->count = keep;
+       sibling = right;
+   }
+
+   for (int i = parent->count; i > index + 1; --i) {
+       parent->children[i] = parent->children[i - 1];
+   }
+   for (int i = parent->count - 1; i > index; --i) {
+       parent->keys[i] = std::move(parent->keys[i - 1]);
+   }
+   parent->children[index + 1] = sibling;
+   parent->keys[index] = std::move(separator);
+   parent->count++;
+}
+
+// Erase from: Tries each child whose key range could hold item, from the right, and rebalances the one it came out of
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::eraseFrom(Node* node, int level, const DataType& item) {
+   if (level == 0) {
+       Leaf* leaf = static_cast<Leaf*>(node);
+       int index = static_cast<int>(std::lower_bound(leaf->items, leaf->items + leaf->count, item) - leaf->items);
+       if (index == leaf->count || leaf->items[index] != item) { // If the item was not found
+           return false;
+       }
+       for (int i = index + 1; i < leaf->count; ++i) {
+           leaf->items[i - 1] = std::move(leaf->items[i]);
+       }
+       leaf->count--;
+       return true;
+   }
+
+   // Equal items can straddle a separator, so every child between these two may hold a copy
+   Inner* inner = static_cast<Inner*>(node);
+   int low = static_cast<int>(std::lower_bound(inner->keys, inner->keys + inner->count - 1, item) - inner->keys);
+   int high = static_cast<int>(std::upper_bound(inner->keys, inner->keys + inner->count - 1, item) - inner->keys);
+   for (int child = high; child >= low; --child) {
+       if (eraseFrom(inner->children[child], level - 1, item)) {
+           if (inner->children[child]->count < (level == 1 ? MIN_LEAF : MIN_INNER)) {
+               rebalance(inner, child, level - 1);
+           }
+           return true;
+       }
+   }
+   return false;
+}
+
+// Rebalance: Borrows one entry from a sibling that can spare it, otherwise merges with a sibling
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::rebalance(Inner* parent, int index, int level) {
+   int minimum = level == 0 ? MIN_LEAF : MIN_INNER;
+   Node* node = parent->children[index];
+   Node* left = index > 0 ? parent->children[index - 1] : nullptr;
+   Node* right = index + 1 < parent->count ? parent->children[index + 1] : nullptr;
+
+   if (level == 0) {
+       Leaf* leaf = static_cast<Leaf*>(node);
+       if (left != nullptr && left->count > minimum) { // Take the left sibling's largest item
+           Leaf* donor = static_cast<Leaf*>(left);
+           for (int i = leaf->count; i > 0; --i) {
+               leaf->items[i] = std::move(leaf->items[i - 1]);
+           }
+           leaf->items[0] = std::move(donor->items[donor->count - 1]);
+           donor->count--;
+           leaf->count++;
+           parent->keys[index - 1] = leaf->items[0];
+       } else if (right != nullptr && right->count > minimum) { // Take the right sibling's smallest item
+           Leaf* donor = static_cast<Leaf*>(right);
+           leaf->items[leaf->count] = std::move(donor->items[0]);
+           for (int i = 1; i < donor->count; ++i) {
+               donor->items[i - 1] = std::move(donor->items[i]);
+           }
+           donor->count--;
+           leaf->count++;
+           parent->keys[index] = donor->items[0];
+       } else { // Both neighbours are at the minimum, so two leaves fit in one
+           int merged = left != nullptr ? index : index + 1; // The right one of the pair is folded into the left
+           Leaf* into = static_cast<Leaf*>(parent->children[merged - 1]);
+           Leaf* from = static_cast<Leaf*>(parent->children[merged]);
+           for (int i = 0; i < from->count; ++i) {
+               into->items[into->count + i] = std::move(from->items[i]);
+           }
+           into->count += from->count;
+           into->next = from->next;
+           removeChild(parent, merged);
+           delete from;
+       }
+   } else {
+       Inner* inner = static_cast<Inner*>(node);
+       if (left != nullptr && left->count > minimum) { // Rotate the left sibling's last child through the parent
+           Inner* donor = static_cast<Inner*>(left);
+           for (int i = inner->count; i > 0; --i) {
+               inner->children[i] = inner->children[i - 1];
+           }
+           for (int i = inner->count - 1; i > 0; --i) {
+               inner->keys[i] = std::move(inner->keys[i - 1]);
+           }
+           inner->children[0] = donor->children[donor->count - 1];
+           inner->keys[0] = std::move(parent->keys[index - 1]);
+           parent->keys[index - 1] = std::move(donor->keys[donor->count - 2]);
+           donor->count--;
+           inner->count++;
+       } else if (right != nullptr && right->count > minimum) { // Rotate the right sibling's first child through the parent
+           Inner* donor = static_cast<Inner*>(right);
+           inner->children[inner->count] = donor->children[0];
+           inner->keys[inner->count - 1] = std::move(parent->keys[index]);
+           parent->keys[index] = std::move(donor->keys[0]);
+           for (int i = 1; i < donor->count; ++i) {
+               donor->children[i - 1] = donor->children[i];
+           }
+           for (int i = 1; i < donor->count - 1; ++i) {
+               donor->keys[i - 1] = std::move(donor->keys[i]);
+           }
+           donor->count--;
+           inner->count++;
+       } else { // Merge the pair, pulling their separator down between them
+           int merged = left != nullptr ? index : index + 1;
+           Inner* into = static_cast<Inner*>(parent->children[merged - 1]);
+           Inner* from = static_cast<Inner*>(parent->children[merged]);
+           into->keys[into->count - 1] = std::move(parent->keys[merged - 1]);
+           for (int i = 0; i < from->count; ++i) {
+               into->children[into->count + i] = from->children[i];
+           }
+           for (int i = 0; i < from->count - 1; ++i) {
+               into->keys[into->count + i] = std::move(from->keys[i]);
+           }
+           into->count += from->count;
+           removeChild(parent, merged);
+           delete from;
+       }
+   }
+}
+
+// Remove child: Closes the gap left by a child and its separator
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::removeChild(Inner* parent, int index) {
+   for (int i = index + 1; i < parent->count; ++i) {
+       parent->children[i - 1] = parent->children[i];
+   }
+   for (int i = index; i < parent->count - 1; ++i) {
+       parent->keys[i - 1] = std::move(parent->keys[i]);
+   }
+   parent->count--;
+}
+
+// Build: Allocates every level, deals the items evenly over the leaves, then links each level to the one below
+template <class DataType, int LeafCapacity, int InnerFanout>
+template <typename Source>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::build(int count, Source source) {
+   std::vector<std::vector<Node*> > levels; // levels[0] holds the leaves, the last level the root
+   int leafCount = (count + LeafCapacity - 1) / LeafCapacity;
+   try {
+       levels.push_back(std::vector<Node*>());
+       levels[0].reserve(leafCount);
+       for (int i = 0; i < leafCount; ++i) {
+           levels[0].push_back(new Leaf);
+       }
+       for (int nodes = leafCount; nodes > 1; ) {
+           nodes = (nodes + InnerFanout - 1) / InnerFanout;
+           levels.push_back(std::vector<Node*>());
+           levels.back().reserve(nodes);
+           for (int i = 0; i < nodes; ++i) {
+               levels.back().push_back(new Inner);
+           }
+       }
+
+       std::vector<const DataType*> lows(leafCount); // The smallest item under each node of the level just built
+       for (int i = 0; i < leafCount; ++i) {
+           Leaf* leaf = static_cast<Leaf*>(levels[0][i]);
+           leaf->count = count / leafCount + (i < count % leafCount ? 1 : 0); // At least half full
+           leaf->next = i + 1 < leafCount ? static_cast<Leaf*>(levels[0][i + 1]) : nullptr;
+           for (int k = 0; k < leaf->count; ++k) {
+               source(leaf->items[k]);
+           }
+           lows[i] = &leaf->items[0];
+       }
+       for (size_t level = 1; level < levels.size(); ++level) {
+           const std::vector<Node*>& below = levels[level - 1];
+           int nodes = static_cast<int>(levels[level].size());
+           int children = static_cast<int>(below.size());
+           int child = 0;
+           for (int i = 0; i < nodes; ++i) {
+               Inner* inner = static_cast<Inner*>(levels[level][i]);
+               inner->count = children / nodes + (i < children % nodes ? 1 : 0);
+               lows[i] = lows[child];
+               for (int k = 0; k < inner->count; ++k, ++child) {
+                   inner->children[k] = below[child];
+                   if (k > 0) {
+                       inner->keys[k - 1] = *lows[child];
+                   }
+               }
+           }
+       }
+   } catch (...) {
+       for (size_t level = 0; level < levels.size(); ++level) {
+           for (size_t i = 0; i < levels[level].size(); ++i) {
+               if (level == 0) {
+                   delete static_cast<Leaf*>(levels[level][i]);
+               } else {
+                   delete static_cast<Inner*>(levels[level][i]);
+               }
+           }
+       }
+       throw;
+   }
+
+   freeNode(root, height);
+   root = leafCount == 0 ? nullptr : levels.back()[0];
+   head = leafCount == 0 ? nullptr : static_cast<Leaf*>(levels[0][0]);
+   height = leafCount == 0 ? 0 : static_cast<int>(levels.size()) - 1;
+   size = count;
+}
+
+// Compact: Rebuilds the tree from the items not marked for removal
+template <class DataType, int LeafCapacity, int InnerFanout>
+int BTreeADTList<DataType, LeafCapacity, InnerFanout>::compact(const std::vector<char>& doomed, int removed) {
+   Leaf* leaf = head;
+   int index = 0;
+   int position = 0;
+   build(size - removed, [&](DataType& slot) {
+       for (;;) {
+           bool keep = !doomed[position++];
+           DataType& item = leaf->items[index];
+           if (++index == leaf->count) {
+               leaf = leaf->next;
+               index = 0;
+           }
+           if (keep) {
+               take(slot, item);
+               return;
+           }
+       }
+   });
+   return removed;
+}
+
+// Take: Moves the item when moving cannot throw, and copies it otherwise
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::take(DataType& slot, DataType& item) {
+   if constexpr (std::is_nothrow_move_assignable<DataType>::value) {
+       slot = std::move(item);
+   } else {
+       slot = item;
+   }
+}
+
+// Free node: Releases a subtree, children first
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::freeNode(Node* node, int level) {
+   if (node == nullptr) {
+       return;
+   }
+   if (level == 0) {
+       delete static_cast<Leaf*>(node);
+       return;
+   }
+   Inner* inner = static_cast<Inner*>(node);
+   for (int i = 0; i < inner->count; ++i) {
+       freeNode(inner->children[i], level - 1);
+   }
+   delete inner;
+}
+
+// Deep copy function: Bulk loads a copy of the other list's items, so the copy starts with full leaves
+template <class DataType, int LeafCapacity, int InnerFanout>
+void BTreeADTList<DataType, LeafCapacity, InnerFanout>::deepCopy(const BTreeADTList& other) {
+   const Leaf* leaf = other.head;
+   int index = 0;
+   build(other.size, [&](DataType& slot) {
+       slot = leaf->items[index];
+       if (++index == leaf->count) {
+           leaf = leaf->next;
+           index = 0;
+       }
+   });
+}
+
+// --- Iterator Methods ---
+
+// Begin: Returns an iterator at the first item of the leftmost leaf
+template <class DataType, int LeafCapacity, int InnerFanout>
+typename BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator BTreeADTList<DataType, LeafCapacity, InnerFanout>::begin() const {
+   return Iterator(this, head, 0);
+}
+
+// End: Returns an iterator past the last leaf
+template <class DataType, int LeafCapacity, int InnerFanout>
+typename BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator BTreeADTList<DataType, LeafCapacity, InnerFanout>::end() const {
+   return Iterator(this, nullptr, 0);
+}
+
+// Iterator Constructor: Initializes an iterator at a leaf and position
+template <class DataType, int LeafCapacity, int InnerFanout>
+BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator::Iterator(const BTreeADTList* myList, const Leaf* current, int index)
+   : myList(myList), current(current), index(index) {}
+
+// Iterator Dereference Operator: Returns the item at the current position
+template <class DataType, int LeafCapacity, int InnerFanout>
+const DataType& BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator::operator*() const {
+   if (current == nullptr) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator out of range");
+   }
+   return current->items[index];
+}
+
+// Iterator Pre-increment Operator: Steps to the next item, following the leaf link at the end of each leaf
+template <class DataType, int LeafCapacity, int InnerFanout>
+typename BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator& BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator::operator++() {
+   if (current != nullptr && ++index == current->count) {
+       current = current->next;
+       index = 0;
+   }
+   return *this;
+}
+
+// Iterator Equality Comparison: Checks if two iterators are equal
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator::operator==(const Iterator& other) const {
+   return myList == other.myList && current == other.current && index == other.index;
+}
+
+// Iterator Inequality Comparison: Checks if two iterators are not equal
+template <class DataType, int LeafCapacity, int InnerFanout>
+bool BTreeADTList<DataType, LeafCapacity, InnerFanout>::Iterator::operator!=(const Iterator& other) const {
+   return !(*this == other);
+}
@@ -0,0 +1,400 @@
+#ifndef BTREE_ADT_LIST_H
+#define BTREE_ADT_LIST_H
+#include <stdexcept>
+#include <vector>
+/**
+ * A B+-tree implementation of an Abstract Data Type (ADT) List.
+ *
+ * This class has the same interface as ArrayADTList, but the items live in the leaves of a
+ * B+-tree, so inserts, lookups and deletes are all O(log n) instead of paying O(n) shifts or
+ * O(n) walks. Every leaf holds a sorted run of items and a pointer to the next leaf, so sorted
+ * iteration walks the leaves in order without going back up the tree. Inner nodes hold only
+ * separator keys and child pointers; keys[i] is no greater than any item under children[i + 1]
+ * and no less than any item under children[i].
+ *
+ * Nodes are aligned to cache lines and sized by default to eight of them (512 bytes) on a 64-bit
+ * build. Lookups search each node with BranchlessSearchPolicy, which prefetches both possible
+ * next probes, so the few lines a node search touches are fetched in parallel. Full nodes are
+ * split on the way down during an insert; a node that falls below half full after a delete
+ * borrows from or merges with a sibling. Equal items are kept in insertion order.
+ *
+ * putItems, deleteItems and eraseIf take a bulk path for large batches: they stream the current
+ * items and the batch through one merge and load a freshly built tree bottom-up, with every
+ * node allocated before any item is moved.
+ *
+ * @param DataType The type of data stored in the list; it must be default constructible.
+ * @param LeafCapacity The number of items per leaf.
+ * @param InnerFanout The number of children per inner node.
+ */
+template <class DataType,
+          int LeafCapacity = (sizeof(DataType) >= 124 ? 4 : 496 / static_cast<int>(sizeof(DataType))),
+          int InnerFanout = (sizeof(DataType) >= 120 ? 4 : (504 + static_cast<int>(sizeof(DataType))) / (8 + static_cast<int>(sizeof(DataType))))>
+class BTreeADTList {
+    static_assert(LeafCapacity >= 2, "BTreeADTList needs room for at least two items per leaf");
+    static_assert(InnerFanout >= 4, "BTreeADTList needs room for at least four children per inner node");
+
+private:
+    /**
+     * Fields shared by leaves and inner nodes. Which kind a node is follows from its depth.
+     */
+    struct Node {
+        int count; // Items in a leaf, children in an inner node.
+    };
+
+    /**
+     * A leaf: a sorted run of items and the link to the next leaf.
+     */
+    struct alignas(64) Leaf : Node {
+        Leaf* next;                   // The following leaf, or nullptr for the last one.
+        DataType items[LeafCapacity]; // The items, sorted, in items[0..count).
+    };
+
+    /**
+     * An inner node: child pointers and the keys that separate them.
+     */
+    struct alignas(64) Inner : Node {
+        Node* children[InnerFanout];    // Leaves in the lowest inner nodes, inner nodes higher up.
+        DataType keys[InnerFanout - 1]; // keys[i] separates children[i] and children[i + 1].
+    };
+
+    static const int MIN_LEAF = LeafCapacity / 2;  // Fewest items a leaf other than the root may hold.
+    static const int MIN_INNER = InnerFanout / 2;  // Fewest children an inner node other than the root may have.
+
+    Node* root; // The root node, or nullptr if the list is empty.
+    Leaf* head; // The leftmost leaf, where iteration starts.
+    int height; // Levels of inner nodes above the leaves; 0 when the root is a leaf.
+    int size;   // Tracks the number of elements in the list.
+
+    /**
+     * Finds the first item that is not less than the given item.
+     *
+     * @param item The value to compare against.
+     * @param leaf Receives the leaf holding that item, or nullptr if every item is less.
+     * @param index Receives the position of that item within its leaf.
+     */
+    void locate(const DataType& item, Leaf*& leaf, int& index) const;
+
+    /**
+     * Places an item after any equal items, splitting full nodes on the way down.
+     *
+     * @param item The item to insert, copied or moved depending on how it was passed.
+     */
+    template <typename Item>
+    void insertItem(Item&& item);
+
+    /**
+     * Reports whether an item lives in a leaf's own storage, which a split would move it out of.
+     *
+     * @param leaf The leaf to check.
+     * @param item The item being inserted.
+     * @return True if item refers to one of the leaf's slots.
+     */
+    static bool holds(const Leaf* leaf, const DataType& item);
+
+    /**
+     * Splits a full child in half, moving its upper half to a new right sibling.
+     *
+     * @param parent The node holding the child; it must not be full.
+     * @param index The position of the child in parent.
+     * @param level The depth of the child above the leaves; 0 for a leaf.
+     */
+    void splitChild(Inner* parent, int index, int level);
+
+    /**
+     * Removes one copy of an item from the subtree under a node, rebalancing on the way up.
+     *
+     * @param node The root of the subtree.
+     * @param level The depth of node above the leaves.
+     * @param item The value to delete.
+     * @return True if a copy was found and removed, otherwise false.
+     */
+    bool eraseFrom(Node* node, int level, const DataType& item);
+
+    /**
+     * Refills a child that has dropped below half full by borrowing from a sibling, or merges
+     * it with one.
+     *
+     * @param parent The node holding the child.
+     * @param index The position of the child in parent.
+     * @param level The depth of the child above the leaves.
+     */
+    void rebalance(Inner* parent, int index, int level);
+
+    /**
+     * Removes a child and the key before it from an inner node, after its contents have been
+     * merged into its left sibling.
+     *
+     * @param parent The node holding the child.
+     * @param index The position of the child in parent; at least 1.
+     */
+    static void removeChild(Inner* parent, int index);
+
+    /**
+     * Replaces the tree with a new one holding count items, filled bottom-up in sorted order.
+     * Every node is allocated before the first item is read, and the old tree is only released
+     * once the new one is complete, so the list is left unchanged if anything throws.
+     *
+     * @param count The number of items the new tree holds.
+     * @param source Called once per item, in sorted order, with the slot to store it in.
+     */
+    template <typename Source>
+    void build(int count, Source source);
+
+    /**
+     * Rebuilds the tree without the items marked for removal.
+     *
+     * @param doomed One flag per item, in sorted order; true for the items to drop.
+     * @param removed The number of flags that are set.
+     * @return removed.
+     */
+    int compact(const std::vector<char>& doomed, int removed);
+
+    /**
+     * Stores an item from the old tree in a slot of the new one, moving it only if that cannot
+     * throw, so a failed rebuild leaves the old tree intact.
+     *
+     * @param slot The slot to fill.
+     * @param item The item to take.
+     */
+    static void take(DataType& slot, DataType& item);
+
+    /**
+     * Releases a node and everything below it.
+     *
+     * @param node The node to free, or nullptr.
+     * @param level The depth of node above the leaves.
+     */
+    static void freeNode(Node* node, int level);
+
+    /**
+     * Copies another list's contents into this one.
+     *
+     * @param other The list to be copied.
+     */
+    void deepCopy(const BTreeADTList& other);
+
+public:
+    /**
+     * Iterator class for traversing the list in sorted order, leaf by leaf.
+     */
+    class Iterator;
+
+    /**
+     * Constructs an empty list.
+     */
+    BTreeADTList();
+
+    /**
+     * Destroys the list and releases every node.
+     */
+    ~BTreeADTList();
+
+    /**
+     * Constructs a copy of another list.
+     *
+     * @param other The list to duplicate.
+     */
+    BTreeADTList(const BTreeADTList& other);
+
+    /**
+     * Assigns another list's contents to this one.
+     *
+     * @param other The list to assign.
+     * @return A reference to this list.
+     */
+    BTreeADTList& operator=(const BTreeADTList& other);
+
+    /**
+     * Takes over another list's nodes without copying any items.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     */
+    BTreeADTList(BTreeADTList&& other) noexcept;
+
+    /**
+     * Releases this list's nodes and takes over another list's.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     * @return A reference to this list.
+     */
+    BTreeADTList& operator=(BTreeADTList&& other) noexcept;
+
+    /**
+     * Exchanges the contents of this list with another in constant time.
+     *
+     * @param other The list to swap with.
+     */
+    void swap(BTreeADTList& other) noexcept;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The current size of the list.
+     */
+    int getLength() const;
+
+    /**
+     * Retrieves the number of levels of inner nodes above the leaves.
+     *
+     * @return 0 when the list fits in a single leaf.
+     */
+    int getHeight() const;
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into place.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Constructs an item from the given arguments and adds it to the list.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     */
+    template <typename... Args>
+    void emplaceItem(Args&&... args);
+
+    /**
+     * Inserts a batch of items. The batch is sorted first if it is not in order. A batch at
+     * least an eighth the size of the list is merged with the current items and bulk loaded
+     * into a new tree with full leaves; a smaller one is inserted item by item.
+     *
+     * @param first Iterator to the first item to insert.
+     * @param last Iterator past the last item to insert.
+     */
+    template <typename InputIterator>
+    void putItems(InputIterator first, InputIterator last);
+
+    /**
+     * Searches for an item in the list.
+     *
+     * @param item The value to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Empties the list, releasing every node.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete.
+     * @return True if deleted, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Removes one copy of each item in a batch. The batch is sorted first if it is not in
+     * order. A batch at least an eighth the size of the list is removed in one merge pass over
+     * the leaves and the survivors are bulk loaded into a new tree; a smaller one is deleted
+     * item by item.
+     *
+     * @param first Iterator to the first item to remove.
+     * @param last Iterator past the last item to remove.
+     * @return The number of items removed; items not in the list are ignored.
+     */
+    template <typename InputIterator>
+    int deleteItems(InputIterator first, InputIterator last);
+
+    /**
+     * Removes every item the predicate accepts, then bulk loads the survivors into a new tree.
+     *
+     * @param predicate Called once per item, in order, with a const reference to it.
+     * @return The number of items removed.
+     */
+    template <typename Predicate>
+    int eraseIf(Predicate predicate);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Always false since the nodes are dynamically allocated.
+     */
+    bool isFull() const;
+
+    /**
+     * Finds the first item that is not less than the given item, in O(log n).
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if every item is less.
+     */
+    Iterator lowerBound(const DataType& item) const;
+
+    /**
+     * Provides an iterator to the start of the list.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    Iterator begin() const;
+
+    /**
+     * Provides an iterator to the end of the list.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    Iterator end() const;
+
+    class Iterator {
+    public:
+        /**
+         * Constructs an iterator at a position in a leaf.
+         *
+         * @param myList The list being traversed.
+         * @param current The current leaf, or nullptr at the end.
+         * @param index The position of the current item within the leaf.
+         */
+        Iterator(const BTreeADTList* myList, const Leaf* current, int index);
+
+        /**
+         * Accesses the item at the iterator's current position.
+         *
+         * @return Reference to the stored item.
+         * @throw std::out_of_range if the iterator is at the end.
+         */
+        const DataType& operator*() const;
+
+        /**
+         * Moves the iterator to the next item, crossing into the next leaf when needed.
+         *
+         * @return Reference to the updated iterator.
+         */
+        Iterator& operator++();
+
+        /**
+         * Compares two iterators for equality.
+         *
+         * @param other The iterator to compare against.
+         * @return True if both point to the same position, otherwise false.
+         */
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * Checks if two iterators are different.
+         *
+         * @param other The iterator to compare against.
+         * @return True if they differ, otherwise false.
+         */
+        bool operator!=(const Iterator& other) const;
+
+    private:
+        const BTreeADTList* myList; // Pointer to the list.
+        const Leaf* current;        // Pointer to the current leaf.
+        int index;                  // Position within the current leaf.
+    };
+};
+
+#include "BTreeADTList.cpp"
+
+#endif // BTREE_ADT_LIST_H
@@ -0,0 +1,156 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "LockedADTList.h"
+#include "LockFreeADTList.h"
+
+// Function prototypes
+double elapsedMs(std::chrono::steady_clock::time_point start);
+template <typename List>
+bool stressTest(const char* label, int threads, int perThread);
+template <typename List>
+void benchmarkThroughput(const char* label, int threads, int keyRange, int operations, int readPercent);
+
+int main() {
+   using namespace std;
+
+   // Stress: each thread inserts its own keys plus shared duplicates, deletes half of its own
+   // keys, and reads throughout; the final contents must match exactly.
+   bool passed = true;
+   for (int threads = 2; threads <= 8; threads *= 2) {
+       passed = stressTest<LockedADTList<int> >("locked", threads, 2000) && passed;
+       passed = stressTest<LockFreeADTList<int> >("lock-free", threads, 2000) && passed;
+   }
+   if (!passed) {
+       cout << "Stress test FAILED" << endl;
+       return 1;
+   }
+
+   // Throughput: a list pre-filled with half the key range, then a mix of lookups and
+   // insert/delete pairs that keeps the size roughly constant.
+   const int keyRange = 4096;
+   const int operations = 200000;
+   int hardware = static_cast<int>(thread::hardware_concurrency());
+   int maxThreads = hardware > 1 ? hardware : 2;
+   cout << endl << "Throughput, " << keyRange << " keys, " << operations << " operations per thread (Mops/s):" << endl;
+   cout << "list\treads%\tthreads\tMops/s" << endl;
+   for (int readPercent = 90; readPercent >= 50; readPercent -= 40) {
+       for (int threads = 1; threads <= maxThreads; threads *= 2) {
+           benchmarkThroughput<LockedADTList<int> >("locked", threads, keyRange, operations, readPercent);
+           benchmarkThroughput<LockFreeADTList<int> >("lock-free", threads, keyRange, operations, readPercent);
+       }
+   }
+
+   return 0;
+}
+
+// Function implementations
+
+// Returns the milliseconds elapsed since start
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+   return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs concurrent inserts, deletes, and lookups, then checks the surviving items and their order
+template <typename List>
+bool stressTest(const char* label, int threads, int perThread) {
+   using namespace std;
+   List list;
+   atomic<int> failures(0);
+   vector<thread> workers;
+   for (int t = 0; t < threads; ++t) {
+       workers.push_back(thread([&list, &failures, t, threads, perThread]() {
+           for (int i = 0; i < perThread; ++i) {
+               list.putItem(i * threads + t); // Keys owned by this thread
+               list.putItem(-1 - (i % 16));   // Duplicates shared by every thread
+           }
+           for (int i = 0; i < perThread; i += 2) {
+               if (!list.deleteItem(i * threads + t)) { // Only this thread deletes its own keys
+                   failures.fetch_add(1);
+               }
+           }
+           int found = 0;
+           for (int i = 1; i < perThread; i += 2) {
+               if (list.getItem(i * threads + t, found) && found != i * threads + t) {
+                   failures.fetch_add(1);
+               }
+           }
+       }));
+   }
+   for (size_t t = 0; t < workers.size(); ++t) {
+       workers[t].join();
+   }
+
+   // Every odd key and every duplicate must remain, in order, with nothing else
+   int expected = (perThread / 2) * threads + perThread * threads;
+   int count = 0;
+   int previous = -1000000;
+   bool ordered = true;
+   list.forEach([&count, &previous, &ordered, &failures, threads](const int& item) {
+       if (item < previous) {
+           ordered = false;
+       }
+       if (item >= 0 && (item / threads) % 2 == 0) { // An even index should have been deleted
+           failures.fetch_add(1);
+       }
+       previous = item;
+       ++count;
+   });
+   bool ok = failures.load() == 0 && ordered && count == expected && list.getLength() == expected;
+   cout << label << "\t" << threads << " threads\t" << count << "/" << expected << " items\t"
+        << (ok ? "ok" : "FAILED") << endl;
+   return ok;
+}
+
+// Measures combined operations per second for a read-mostly or mixed workload
+template <typename List>
+void benchmarkThroughput(const char* label, int threads, int keyRange, int operations, int readPercent) {
+   using namespace std;
+   List list;
+   for (int key = 0; key < keyRange; key += 2) {
+       list.putItem(key);
+   }
+
+   atomic<bool> go(false);
+   atomic<long long> hits(0);
+   vector<thread> workers;
+   for (int t = 0; t < threads; ++t) {
+       workers.push_back(thread([&, t]() {
+           unsigned int seed = 2463534242u + t * 7919u;
+           long long localHits = 0;
+           int found = 0;
+           while (!go.load()) {
+               this_thread::yield();
+           }
+           for (int i = 0; i < operations; ++i) {
+               seed ^= seed << 13; // xorshift32
+               seed ^= seed >> 17;
+               seed ^= seed << 5;
+               int key = static_cast<int>(seed % static_cast<unsigned int>(keyRange));
+               if (static_cast<int>((seed >> 16) % 100) < readPercent) {
+                   localHits += list.getItem(key, found) ? 1 : 0;
+               } else if (list.deleteItem(key)) {
+                   list.putItem(key); // Put it back so the size stays stable
+               } else {
+                   list.putItem(key);
+                   list.deleteItem(key);
+               }
+           }
+           hits.fetch_add(localHits);
+       }));
+   }
+
+   chrono::steady_clock::time_point start = chrono::steady_clock::now();
+   go.store(true);
+   for (size_t t = 0; t < workers.size(); ++t) {
+       workers[t].join();
+   }
+   double ms = elapsedMs(start);
+   double mops = static_cast<double>(operations) * threads / (ms * 1000.0);
+   cout << label << "\t" << readPercent << "\t" << threads << "\t" << mops << endl;
+   if (hits.load() < 0) {
+       cout << "unreachable" << endl; // Keeps the lookups observable
+   }
+}
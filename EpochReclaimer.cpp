@@ -0,0 +1,128 @@
+#include <stdexcept>
+#include "EpochReclaimer.h"
+
+// The definitions live in a header-included file, so they are marked inline to keep one copy per program.
+
+// Constructor: Starts at epoch zero with every record free
+inline EpochReclaimer::EpochReclaimer() : globalEpoch(0) {
+   for (int i = 0; i < MAX_THREADS; ++i) {
+       records[i].claimed.store(false);
+       records[i].active.store(false);
+       records[i].localEpoch.store(0);
+       records[i].depth = 0;
+       records[i].observedEpoch = 0;
+       records[i].pending = 0;
+   }
+}
+
+// Destructor: Frees everything still waiting, since every thread is gone by now
+inline EpochReclaimer::~EpochReclaimer() {
+   for (int i = 0; i < MAX_THREADS; ++i) {
+       for (int bucket = 0; bucket < 3; ++bucket) {
+           freeAll(records[i].limbo[bucket]);
+       }
+   }
+}
+
+// Instance: Returns the shared reclaimer, created on first use
+inline EpochReclaimer& EpochReclaimer::instance() {
+   static EpochReclaimer reclaimer;
+   return reclaimer;
+}
+
+// Local record: Claims a free record for this thread the first time it is needed
+inline EpochReclaimer::Record& EpochReclaimer::localRecord() {
+   static thread_local ThreadHandle handle = { nullptr };
+   if (handle.record == nullptr) {
+       EpochReclaimer& reclaimer = instance();
+       for (int i = 0; i < MAX_THREADS && handle.record == nullptr; ++i) {
+           bool expected = false;
+           if (reclaimer.records[i].claimed.compare_exchange_strong(expected, true)) {
+               handle.record = &reclaimer.records[i]; // Any limbo left by a previous owner comes along
+           }
+       }
+       if (handle.record == nullptr) {
+           throw std::runtime_error("EpochReclaimer: too many threads.");
+       }
+   }
+   return *handle.record;
+}
+
+// Thread handle destructor: Gives the record back; its limbo is freed by the next owner or at exit
+inline EpochReclaimer::ThreadHandle::~ThreadHandle() {
+   if (record != nullptr) {
+       record->claimed.store(false);
+   }
+}
+
+// Guard constructor: Publishes the epoch this thread is reading in
+inline EpochReclaimer::Guard::Guard() {
+   Record& record = localRecord();
+   if (record.depth++ == 0) {
+       EpochReclaimer& reclaimer = instance();
+       unsigned long long epoch = reclaimer.globalEpoch.load();
+       record.localEpoch.store(epoch);
+       record.active.store(true); // Sequentially consistent, so advancing threads see us before we read nodes
+       epoch = reclaimer.globalEpoch.load(); // The epoch may have moved before we became visible
+       record.localEpoch.store(epoch);
+       collect(record, epoch);
+   }
+}
+
+// Guard destructor: Leaves the epoch once the outermost guard ends
+inline EpochReclaimer::Guard::~Guard() {
+   Record& record = localRecord();
+   if (--record.depth == 0) {
+       record.active.store(false);
+   }
+}
+
+// Retire: Queues the object under the current epoch and occasionally tries to advance
+inline void EpochReclaimer::retire(void* object, void (*destroy)(void*)) {
+   EpochReclaimer& reclaimer = instance();
+   Record& record = localRecord();
+   unsigned long long epoch = reclaimer.globalEpoch.load(); // Stamp with the epoch at retirement, not at entry
+   record.limbo[epoch % 3].push_back(Retired{object, destroy});
+   if (++record.pending >= ADVANCE_THRESHOLD) {
+       record.pending = 0;
+       reclaimer.tryAdvance();
+       collect(record, reclaimer.globalEpoch.load());
+   }
+}
+
+// Drain: Frees every retired object, for use once all threads are quiescent
+inline void EpochReclaimer::drain() {
+   EpochReclaimer& reclaimer = instance();
+   for (int i = 0; i < MAX_THREADS; ++i) {
+       for (int bucket = 0; bucket < 3; ++bucket) {
+           freeAll(reclaimer.records[i].limbo[bucket]);
+       }
+   }
+}
+
+// Collect: On a new epoch, frees the bucket whose objects were retired two or more epochs ago
+inline void EpochReclaimer::collect(Record& record, unsigned long long epoch) {
+   if (record.observedEpoch != epoch) {
+       record.observedEpoch = epoch;
+       freeAll(record.limbo[(epoch + 1) % 3]); // Holds stamps congruent to epoch - 2, all old enough
+   }
+}
+
+// Try advance: Moves the global epoch forward if no active thread lags behind it
+inline void EpochReclaimer::tryAdvance() {
+   unsigned long long epoch = globalEpoch.load();
+   for (int i = 0; i < MAX_THREADS; ++i) {
+       if (records[i].claimed.load() && records[i].active.load() && records[i].localEpoch.load() != epoch) {
+           return; // Someone is still reading in an older epoch
+       }
+   }
+   globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+// Free all: Runs the destroy function of every object in the bucket
+inline void EpochReclaimer::freeAll(std::vector<Retired>& bucket) {
+   for (size_t i = 0; i < bucket.size(); ++i) {
+       bucket[i].destroy(bucket[i].object);
+   }
+   bucket.clear();
+}
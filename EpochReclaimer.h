@@ -0,0 +1,123 @@
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+#include <atomic>
+#include <vector>
+/**
+ * Epoch-based memory reclamation for the lock-free containers.
+ *
+ * A thread wraps every operation that reads shared nodes in a Guard. Nodes that have been
+ * unlinked are handed to retire() instead of being freed right away. The global epoch only
+ * advances once every thread inside a Guard has seen the current epoch, and a retired node
+ * is freed two epochs after it was retired, when no thread can still be holding it.
+ *
+ * One reclaimer is shared by every container in the process. Each thread claims one of
+ * MAX_THREADS records the first time it enters a Guard and gives it back when it exits.
+ */
+class EpochReclaimer {
+public:
+    static const int MAX_THREADS = 256; // Threads that may hold a record at the same time.
+
+    /**
+     * Marks the current thread as reading shared nodes for as long as the guard lives.
+     */
+    class Guard {
+    public:
+        /**
+         * Enters the current epoch.
+         */
+        Guard();
+
+        /**
+         * Leaves the epoch so the reclaimer may advance past it.
+         */
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    /**
+     * Hands an unlinked object to the reclaimer, which frees it once no guard can reach it.
+     *
+     * @param object The object to free; it must already be unreachable for new readers.
+     * @param destroy The function that frees it.
+     */
+    static void retire(void* object, void (*destroy)(void*));
+
+    /**
+     * Frees every retired object. Only safe when no thread is inside a Guard.
+     */
+    static void drain();
+
+private:
+    /**
+     * An object waiting to be freed.
+     */
+    struct Retired {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    /**
+     * Per-thread state, claimed by one thread at a time.
+     */
+    struct Record {
+        std::atomic<bool> claimed;          // Held by a live thread.
+        std::atomic<bool> active;           // Inside at least one Guard.
+        std::atomic<unsigned long long> localEpoch; // Epoch seen when the outermost Guard was entered.
+        int depth;                          // Nesting depth of Guards on the owning thread.
+        unsigned long long observedEpoch;   // Last epoch for which limbo was cleaned.
+        std::vector<Retired> limbo[3];      // Retired objects, bucketed by epoch modulo 3.
+        int pending;                        // Objects retired since the last advance attempt.
+    };
+
+    /**
+     * Releases the calling thread's record when the thread exits.
+     */
+    struct ThreadHandle {
+        Record* record;
+        ~ThreadHandle();
+    };
+
+    static const int ADVANCE_THRESHOLD = 64; // Retirements between attempts to advance.
+
+    std::atomic<unsigned long long> globalEpoch;
+    Record records[MAX_THREADS];
+
+    EpochReclaimer();
+    ~EpochReclaimer();
+
+    /**
+     * Returns the process-wide reclaimer.
+     */
+    static EpochReclaimer& instance();
+
+    /**
+     * Returns the calling thread's record, claiming a free one on first use.
+     *
+     * @throw std::runtime_error if more than MAX_THREADS threads are using the reclaimer.
+     */
+    static Record& localRecord();
+
+    /**
+     * Frees a record's bucket of objects that are at least two epochs old.
+     *
+     * @param record The record whose limbo should be cleaned.
+     * @param epoch The current global epoch.
+     */
+    static void collect(Record& record, unsigned long long epoch);
+
+    /**
+     * Advances the global epoch if every active thread has caught up with it.
+     */
+    void tryAdvance();
+
+    /**
+     * Frees every object in a bucket.
+     */
+    static void freeAll(std::vector<Retired>& bucket);
+};
+
+#include "EpochReclaimer.cpp"
+
+#endif // EPOCH_RECLAIMER_H
@@ -0,0 +1,433 @@
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <utility>
+#include "GappedADTList.h"
+
+// Constructor: Initializes an empty list with a single segment
+template <class DataType>
+GappedADTList<DataType>::GappedADTList() {
+   size = 0;
+   allocate(MIN_SEGMENT_SIZE);
+}
+
+// Destructor: Releases the buffer
+template <class DataType>
+GappedADTList<DataType>::~GappedADTList() {
+   delete[] slots;
+   delete[] counts;
+}
+
+// Copy Constructor: Creates a deep copy of another list
+template <class DataType>
+GappedADTList<DataType>::GappedADTList(const GappedADTList& other) {
+   size = 0;
+   deepCopy(other);
+}
+
+// Assignment Operator: Copies the other list aside, then swaps it in
+template <class DataType>
+GappedADTList<DataType>& GappedADTList<DataType>::operator=(const GappedADTList& other) {
+   if (this != &other) { // Check for self-assignment
+       GappedADTList copy(other);
+       swap(copy); // The old buffer is released when copy goes out of scope
+   }
+   return *this;
+}
+
+// Move Constructor: Takes over the other list's buffer
+template <class DataType>
+GappedADTList<DataType>::GappedADTList(GappedADTList&& other) noexcept
+   : slots(other.slots), counts(other.counts), capacity(other.capacity), segmentSize(other.segmentSize),
+     segmentCount(other.segmentCount), height(other.height), size(other.size) {
+   other.slots = nullptr; // The other list will allocate again if it is reused
+   other.counts = nullptr;
+   other.capacity = 0;
+   other.segmentCount = 0;
+   other.height = 0;
+   other.size = 0;
+}
+
+// Move Assignment Operator: Releases this list's buffer and takes over the other list's
+template <class DataType>
+GappedADTList<DataType>& GappedADTList<DataType>::operator=(GappedADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       GappedADTList taken(std::move(other));
+       swap(taken); // The old buffer is released when taken goes out of scope
+   }
+   return *this;
+}
+
+// Swap: Exchanges the buffers of this list with another list
+template <class DataType>
+void GappedADTList<DataType>::swap(GappedADTList& other) noexcept {
+   std::swap(slots, other.slots);
+   std::swap(counts, other.counts);
+   std::swap(capacity, other.capacity);
+   std::swap(segmentSize, other.segmentSize);
+   std::swap(segmentCount, other.segmentCount);
+   std::swap(height, other.height);
+   std::swap(size, other.size);
+}
+
+// Get length: Returns the number of items in the list
+template <class DataType>
+int GappedADTList<DataType>::getLength() const {
+   return size;
+}
+
+// Get capacity: Returns the number of slots, gaps included
+template <class DataType>
+int GappedADTList<DataType>::getCapacity() const {
+   return capacity;
+}
+
+// Insert item to the list: Copies the item into place
+template <class DataType>
+void GappedADTList<DataType>::putItem(const DataType& item) {
+   insertItem(item);
+}
+
+// Insert item to the list: Moves the item into place
+template <class DataType>
+void GappedADTList<DataType>::putItem(DataType&& item) {
+   insertItem(std::move(item));
+}
+
+// Emplace item: Builds the item from args, then moves it into place
+template <class DataType>
+template <typename... Args>
+void GappedADTList<DataType>::emplaceItem(Args&&... args) {
+   insertItem(DataType(std::forward<Args>(args)...));
+}
+
+// Insert item: Shifts only the larger items of one segment, spreading out a window first if it is full
+template <class DataType>
+template <typename Item>
+void GappedADTList<DataType>::insertItem(Item&& item) {
+   if (capacity == 0) {
+       allocate(MIN_SEGMENT_SIZE); // Reused after being moved from
+   }
+   int segment = std::max(findSegment(item, true) - 1, 0); // The last segment starting at or before item
+   if (counts[segment] == segmentSize) {
+       const DataType* address = &item;
+       if (std::less_equal<const DataType*>()(slots, address) && std::less<const DataType*>()(address, slots + capacity)) {
+           // Rebalancing moves the slots the item lives in, so copy it out first
+           DataType held(static_cast<const DataType&>(item));
+           insertItem(std::move(held));
+           return;
+       }
+       rebalance(segment, 1);
+       segment = std::max(findSegment(item, true) - 1, 0); // The segments have moved
+   }
+
+   DataType* run = slots + segment * segmentSize;
+   int index = static_cast<int>(std::upper_bound(run, run + counts[segment], item) - run); // After equal items
+   for (int i = counts[segment]; i > index; --i) {
+       run[i] = std::move(run[i - 1]);
+   }
+   run[index] = std::forward<Item>(item);
+   counts[segment]++;
+   size++;
+}
+
+// Retrieve an item: Binary searches the segments, then the segment
+template <class DataType>
+bool GappedADTList<DataType>::getItem(const DataType& item, DataType& found_item) const {
+   int segment, index;
+   locate(item, segment, index);
+   if (segment < segmentCount && slots[segment * segmentSize + index] == item) {
+       found_item = slots[segment * segmentSize + index];
+       return true;
+   }
+   return false;
+}
+
+// Make list empty: Drops every item and shrinks back to a single segment
+template <class DataType>
+void GappedADTList<DataType>::makeEmpty() {
+   DataType* oldSlots = slots;
+   int* oldCounts = counts;
+   allocate(MIN_SEGMENT_SIZE);
+   delete[] oldSlots;
+   delete[] oldCounts;
+   size = 0;
+}
+
+// Delete an item: Closes the gap within its segment, rebalancing if the segment runs low
+template <class DataType>
+bool GappedADTList<DataType>::deleteItem(const DataType& item) {
+   int segment, index;
+   locate(item, segment, index);
+   if (segment == segmentCount || slots[segment * segmentSize + index] != item) {
+       return false;
+   }
+   DataType* run = slots + segment * segmentSize;
+   for (int i = index + 1; i < counts[segment]; ++i) {
+       run[i - 1] = std::move(run[i]);
+   }
+   counts[segment]--;
+   size--;
+
+   if (segmentCount > 1) {
+       if (size < capacity / 8) {
+           resize(size); // Mostly gaps, so give the memory back
+       } else if (counts[segment] * 8 < segmentSize) {
+           rebalance(segment, 0); // Below the leaf density bound; this also keeps every segment non-empty
+       }
+   }
+   return true;
+}
+
+// Check if list is full: Always returns false since the buffer grows as needed
+template <class DataType>
+bool GappedADTList<DataType>::isFull() const {
+   return false;
+}
+
+// Lower bound: Returns an iterator at the first item not less than item
+template <class DataType>
+typename GappedADTList<DataType>::Iterator GappedADTList<DataType>::lowerBound(const DataType& item) const {
+   int segment, index;
+   locate(item, segment, index);
+   return Iterator(this, segment, index);
+}
+
+// Find segment: Binary searches the first item of each segment
+template <class DataType>
+int GappedADTList<DataType>::findSegment(const DataType& item, bool after) const {
+   if (size == 0) {
+       return 0;
+   }
+   int low = 0;
+   int high = segmentCount;
+   while (low < high) {
+       int middle = low + (high - low) / 2;
+       const DataType& first = slots[middle * segmentSize]; // Never a gap, since no segment is empty
+       if (after ? !(item < first) : first < item) {
+           low = middle + 1;
+       } else {
+           high = middle;
+       }
+   }
+   return low;
+}
+
+// Locate: Searches the segment before the first one starting at or after item
+template <class DataType>
+void GappedADTList<DataType>::locate(const DataType& item, int& segment, int& index) const {
+   if (size == 0) {
+       segment = segmentCount;
+       index = 0;
+       return;
+   }
+   segment = findSegment(item, false);
+   index = 0;
+   if (segment > 0) {
+       const DataType* run = slots + (segment - 1) * segmentSize;
+       int found = static_cast<int>(std::lower_bound(run, run + counts[segment - 1], item) - run);
+       if (found < counts[segment - 1]) { // Otherwise the answer is the first item of segment
+           segment--;
+           index = found;
+       }
+   }
+}
+
+// Upper density: Interpolates from 1 at the leaves to 3/4 at the root
+template <class DataType>
+double GappedADTList<DataType>::upperDensity(int level) const {
+   return height == 0 ? 1.0 : 1.0 - 0.25 * level / height;
+}
+
+// Lower density: Interpolates from 1/8 at the leaves to 1/4 at the root
+template <class DataType>
+double GappedADTList<DataType>::lowerDensity(int level) const {
+   return height == 0 ? 0.125 : 0.125 + 0.125 * level / height;
+}
+
+// Rebalance: Doubles the window until it is within its bounds, then spreads it out
+template <class DataType>
+void GappedADTList<DataType>::rebalance(int segment, int delta) {
+   int window = 2;
+   int items = counts[segment]; // Counted incrementally as the window doubles
+   for (int level = 1; level <= height; ++level, window *= 2) {
+       int first = segment & ~(window - 1);
+       int half = window / 2;
+       int sibling = (segment & half) ? first : first + half; // The half not yet counted
+       for (int k = sibling; k < sibling + half; ++k) {
+           items += counts[k];
+       }
+       double slotsInWindow = static_cast<double>(window) * segmentSize;
+       bool within = delta > 0
+           ? items + delta <= upperDensity(level) * slotsInWindow && items <= window * (segmentSize - 1) // Room for the insert
+           : items >= lowerDensity(level) * slotsInWindow;
+       if (within) {
+           spread(first, window, items);
+           return;
+       }
+   }
+   resize(size); // Even the whole buffer is out of bounds
+}
+
+// Spread: Packs the window's items to its front, then deals them out from the back
+template <class DataType>
+void GappedADTList<DataType>::spread(int first, int segments, int items) {
+   int destination = first * segmentSize;
+   for (int k = first; k < first + segments; ++k) {
+       for (int i = 0; i < counts[k]; ++i) {
+           int source = k * segmentSize + i;
+           if (destination != source) {
+               slots[destination] = std::move(slots[source]);
+           }
+           ++destination;
+       }
+   }
+   // Walking backwards, every item moves right or stays, so none is overwritten before it moves
+   int source = first * segmentSize + items - 1;
+   for (int k = segments - 1; k >= 0; --k) {
+       int share = items / segments + (k < items % segments ? 1 : 0);
+       counts[first + k] = share;
+       for (int i = share - 1; i >= 0; --i) {
+           int target = (first + k) * segmentSize + i;
+           if (target != source) {
+               slots[target] = std::move(slots[source]);
+           }
+           --source;
+       }
+   }
+}
+
+// Resize: Moves the items into a buffer about half full, spread evenly over its segments
+template <class DataType>
+void GappedADTList<DataType>::resize(int items) {
+   int newCapacity = MIN_SEGMENT_SIZE;
+   while (newCapacity / 2 < items && newCapacity <= INT_MAX / 2) {
+       newCapacity *= 2;
+   }
+   DataType* oldSlots = slots;
+   int* oldCounts = counts;
+   int oldSegmentSize = segmentSize;
+   int oldSegmentCount = segmentCount;
+   allocate(newCapacity);
+
+   int segment = 0;
+   int index = 0;
+   int share = size / segmentCount + (0 < size % segmentCount ? 1 : 0);
+   for (int k = 0; k < oldSegmentCount; ++k) {
+       for (int i = 0; i < oldCounts[k]; ++i) {
+           while (index == share) { // Move on to the next segment once this one has its share
+               counts[segment] = share;
+               ++segment;
+               index = 0;
+               share = size / segmentCount + (segment < size % segmentCount ? 1 : 0);
+           }
+           slots[segment * segmentSize + index++] = std::move(oldSlots[k * oldSegmentSize + i]);
+       }
+   }
+   if (segment < segmentCount) {
+       counts[segment] = index;
+   }
+   delete[] oldSlots;
+   delete[] oldCounts;
+}
+
+// Allocate: Creates an empty buffer and picks a segment size near log2 of its capacity
+template <class DataType>
+void GappedADTList<DataType>::allocate(int newCapacity) {
+   DataType* newSlots = new DataType[newCapacity];
+   int* newCounts;
+   int newSegmentSize = MIN_SEGMENT_SIZE;
+   int logCapacity = 0;
+   while ((1 << (logCapacity + 1)) <= newCapacity && logCapacity < 30) {
+       ++logCapacity;
+   }
+   while (newSegmentSize < logCapacity) {
+       newSegmentSize *= 2;
+   }
+   try {
+       newCounts = new int[newCapacity / newSegmentSize](); // Every segment starts empty
+   } catch (...) {
+       delete[] newSlots;
+       throw;
+   }
+   slots = newSlots;
+   counts = newCounts;
+   capacity = newCapacity;
+   segmentSize = newSegmentSize;
+   segmentCount = newCapacity / newSegmentSize;
+   height = 0;
+   while ((1 << height) < segmentCount) {
+       ++height;
+   }
+}
+
+// Deep copy function: Copies the other list's buffer, gaps and all, so no rebalancing is needed
+template <class DataType>
+void GappedADTList<DataType>::deepCopy(const GappedADTList& other) {
+   allocate(other.capacity > 0 ? other.capacity : MIN_SEGMENT_SIZE);
+   try {
+       for (int k = 0; k < other.segmentCount; ++k) {
+           counts[k] = other.counts[k];
+           for (int i = 0; i < other.counts[k]; ++i) {
+               slots[k * segmentSize + i] = other.slots[k * segmentSize + i];
+           }
+       }
+   } catch (...) {
+       delete[] slots; // Only called from the copy constructor, whose destructor will not run
+       delete[] counts;
+       throw;
+   }
+   size = other.size;
+}
+
+// --- Iterator Methods ---
+
+// Begin: Returns an iterator at the first item of the first segment
+template <class DataType>
+typename GappedADTList<DataType>::Iterator GappedADTList<DataType>::begin() const {
+   return size == 0 ? end() : Iterator(this, 0, 0);
+}
+
+// End: Returns an iterator past the last segment
+template <class DataType>
+typename GappedADTList<DataType>::Iterator GappedADTList<DataType>::end() const {
+   return Iterator(this, segmentCount, 0);
+}
+
+// Iterator Constructor: Initializes an iterator at a segment and position
+template <class DataType>
+GappedADTList<DataType>::Iterator::Iterator(const GappedADTList* myList, int segment, int index)
+   : myList(myList), segment(segment), index(index) {}
+
+// Iterator Dereference Operator: Returns the item at the current position
+template <class DataType>
+const DataType& GappedADTList<DataType>::Iterator::operator*() const {
+   if (segment >= myList->segmentCount) {
+       throw std::out_of_range("Iterator out of range");
+   }
+   return myList->slots[segment * myList->segmentSize + index];
+}
+
+// Iterator Pre-increment Operator: Steps to the next item, skipping the gap at the end of each segment
+template <class DataType>
+typename GappedADTList<DataType>::Iterator& GappedADTList<DataType>::Iterator::operator++() {
+   if (segment < myList->segmentCount && ++index >= myList->counts[segment]) {
+       index = 0;
+       do {
+           ++segment;
+       } while (segment < myList->segmentCount && myList->counts[segment] == 0);
+   }
+   return *this;
+}
+
+// Iterator Equality Comparison: Checks if two iterators are equal
+template <class DataType>
+bool GappedADTList<DataType>::Iterator::operator==(const Iterator& other) const {
+   return myList == other.myList && segment == other.segment && index == other.index;
+}
+
+// Iterator Inequality Comparison: Checks if two iterators are not equal
+template <class DataType>
+bool GappedADTList<DataType>::Iterator::operator!=(const Iterator& other) const {
+   return !(*this == other);
+}
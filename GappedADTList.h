@@ -0,0 +1,312 @@
+#ifndef GAPPED_ADT_LIST_H
+#define GAPPED_ADT_LIST_H
+#include <stdexcept>
+/**
+ * A sorted, gapped-array (packed memory array) implementation of an Abstract Data Type (ADT) List.
+ *
+ * This class has the same interface as ArrayADTList, but the buffer deliberately keeps empty
+ * slots spread through it so that a sorted insert only shifts items within one small segment
+ * instead of the whole tail of the array.
+ *
+ * The buffer is cut into segments of segmentSize slots (a power of two close to log2 of the
+ * capacity). Each segment keeps its items packed at its front, in order. Segments pair up
+ * into windows of 2, 4, 8, ... segments, forming an implicit binary tree whose root is the
+ * whole buffer. Every level of the tree has density bounds, loosest at the leaves and
+ * tightest at the root. When an insert finds its segment full, or a delete leaves one too
+ * empty, the smallest enclosing window that is within its bounds has its items spread evenly
+ * over its segments; if even the root is out of bounds, the buffer is resized. This costs
+ * amortized O(log^2 n) moves per update.
+ *
+ * No segment is ever left empty while the list holds items, so the first slot of every
+ * segment is a valid key: lookups binary search those keys to pick a segment and then
+ * binary search within it, in O(log n).
+ *
+ * @param DataType The type of data stored in the list; it must be default constructible.
+ */
+template <class DataType>
+class GappedADTList {
+private:
+    static const int MIN_SEGMENT_SIZE = 8; // Smallest segment; also the smallest capacity.
+
+    DataType* slots;  // capacity slots; segment k covers [k * segmentSize, (k + 1) * segmentSize).
+    int* counts;      // Items in use at the front of each segment.
+    int capacity;     // Total number of slots.
+    int segmentSize;  // Slots per segment, a power of two.
+    int segmentCount; // Number of segments, a power of two.
+    int height;       // log2(segmentCount), the level of the root window.
+    int size;         // Tracks the number of elements in the list.
+
+    /**
+     * Finds the first segment whose first item is greater than, or not less than, item.
+     *
+     * @param item The value to compare against.
+     * @param after True to look for greater, false for not less.
+     * @return The segment found, or segmentCount if there is none.
+     */
+    int findSegment(const DataType& item, bool after) const;
+
+    /**
+     * Locates the first item that is not less than the given item.
+     *
+     * @param item The value to compare against.
+     * @param segment Receives the segment of that item, or segmentCount if there is none.
+     * @param index Receives the position of that item within its segment.
+     */
+    void locate(const DataType& item, int& segment, int& index) const;
+
+    /**
+     * Places an item after any equal items, making room in its segment first if it is full.
+     *
+     * @param item The item to insert, copied or moved depending on how it was passed.
+     */
+    template <typename Item>
+    void insertItem(Item&& item);
+
+    /**
+     * Upper density bound of a window at the given level: 1 at the leaves, 3/4 at the root.
+     *
+     * @param level 0 for a single segment, height for the whole buffer.
+     * @return The largest allowed fraction of used slots.
+     */
+    double upperDensity(int level) const;
+
+    /**
+     * Lower density bound of a window at the given level: 1/8 at the leaves, 1/4 at the root.
+     *
+     * @param level 0 for a single segment, height for the whole buffer.
+     * @return The smallest allowed fraction of used slots.
+     */
+    double lowerDensity(int level) const;
+
+    /**
+     * Spreads out the smallest window around a segment that is within its density bounds
+     * once its item count changes by delta, or resizes the buffer if no window is.
+     *
+     * @param segment The segment that is full or too empty.
+     * @param delta 1 when an item is about to be inserted, 0 after a delete.
+     */
+    void rebalance(int segment, int delta);
+
+    /**
+     * Spreads the items of a window evenly over its segments, in place.
+     *
+     * @param first The first segment of the window.
+     * @param segments The number of segments in the window.
+     * @param items The number of items in the window.
+     */
+    void spread(int first, int segments, int items);
+
+    /**
+     * Moves every item into a freshly allocated buffer sized for about half occupancy.
+     *
+     * @param items The number of items the new buffer must be sized for.
+     */
+    void resize(int items);
+
+    /**
+     * Allocates an empty buffer with the given number of slots and sets up its segments.
+     *
+     * @param newCapacity The number of slots, a power of two no smaller than MIN_SEGMENT_SIZE.
+     */
+    void allocate(int newCapacity);
+
+    /**
+     * Copies another list's contents into this one, which must not own a buffer yet. If a copy
+     * throws, the new buffer is released before the exception propagates.
+     *
+     * @param other The list to be copied.
+     */
+    void deepCopy(const GappedADTList& other);
+
+public:
+    /**
+     * Iterator class for traversing the list in sorted order, skipping the gaps.
+     */
+    class Iterator;
+
+    /**
+     * Constructs an empty list.
+     */
+    GappedADTList();
+
+    /**
+     * Destroys the list and releases its buffer.
+     */
+    ~GappedADTList();
+
+    /**
+     * Constructs a copy of another list.
+     *
+     * @param other The list to duplicate.
+     */
+    GappedADTList(const GappedADTList& other);
+
+    /**
+     * Assigns another list's contents to this one.
+     *
+     * @param other The list to assign.
+     * @return A reference to this list.
+     */
+    GappedADTList& operator=(const GappedADTList& other);
+
+    /**
+     * Takes over another list's buffer without copying any items.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     */
+    GappedADTList(GappedADTList&& other) noexcept;
+
+    /**
+     * Releases this list's buffer and takes over another list's.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     * @return A reference to this list.
+     */
+    GappedADTList& operator=(GappedADTList&& other) noexcept;
+
+    /**
+     * Exchanges the contents of this list with another in constant time.
+     *
+     * @param other The list to swap with.
+     */
+    void swap(GappedADTList& other) noexcept;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The current size of the list.
+     */
+    int getLength() const;
+
+    /**
+     * Retrieves the number of slots in the buffer, gaps included.
+     *
+     * @return The capacity of the underlying buffer.
+     */
+    int getCapacity() const;
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into place.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Constructs an item from the given arguments and adds it to the list.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     */
+    template <typename... Args>
+    void emplaceItem(Args&&... args);
+
+    /**
+     * Searches for an item in the list.
+     *
+     * @param item The value to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Empties the list and shrinks the buffer back to a single segment.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete.
+     * @return True if deleted, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Always false since the buffer grows as needed.
+     */
+    bool isFull() const;
+
+    /**
+     * Finds the first item that is not less than the given item, in O(log n).
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if every item is less.
+     */
+    Iterator lowerBound(const DataType& item) const;
+
+    /**
+     * Provides an iterator to the start of the list.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    Iterator begin() const;
+
+    /**
+     * Provides an iterator to the end of the list.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    Iterator end() const;
+
+    class Iterator {
+    public:
+        /**
+         * Constructs an iterator at a slot of the list.
+         *
+         * @param myList The list being traversed.
+         * @param segment The segment of the current item, or segmentCount at the end.
+         * @param index Position of the current item within its segment.
+         */
+        Iterator(const GappedADTList* myList, int segment, int index);
+
+        /**
+         * Accesses the value at the iterator's current position.
+         *
+         * @return Reference to the stored data.
+         * @throw std::out_of_range if the iterator is at the end.
+         */
+        const DataType& operator*() const;
+
+        /**
+         * Moves the iterator to the next item, crossing into the next segment when needed.
+         *
+         * @return Reference to the updated iterator.
+         */
+        Iterator& operator++();
+
+        /**
+         * Compares two iterators for equality.
+         *
+         * @param other The iterator to compare against.
+         * @return True if both point to the same position, otherwise false.
+         */
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * Checks if two iterators are different.
+         *
+         * @param other The iterator to compare against.
+         * @return True if they differ, otherwise false.
+         */
+        bool operator!=(const Iterator& other) const;
+
+    private:
+        const GappedADTList* myList; // Pointer to the list.
+        int segment;                 // Segment of the current item.
+        int index;                   // Position within the current segment.
+    };
+};
+
+#include "GappedADTList.cpp"
+
+#endif // GAPPED_ADT_LIST_H
@@ -0,0 +1,48 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "ArrayADTList.h"
+#include "LinkedADTList.h"
+#include "ParallelImporter.h"
+#include "Customer.h"
+
+// Function prototypes
+template <typename List>
+void importWithThreads(const char* label, const std::string& filename, int threads, long long chunkBytes);
+
+// Usage: ImportDriver [FILE] [MAX_THREADS] [CHUNK_BYTES]
+int main(int argc, char* argv[]) {
+   using namespace std;
+
+   string filename = argc > 1 ? argv[1] : "customer_data/Customer.txt";
+   int maxThreads = argc > 2 ? atoi(argv[2]) : static_cast<int>(ParallelImporter<Customer>().getThreadCount());
+   long long chunkBytes = argc > 3 ? atoll(argv[3]) : ParallelImporter<Customer>::DEFAULT_CHUNK_BYTES;
+
+   // Import the same file with 1, 2, 4, ... threads so the scaling of each stage is visible
+   cout << "Importing " << filename << " in chunks of " << chunkBytes << " bytes (ms):" << endl;
+   cout << "list\tthreads\tchunks\trecords\tsplit\tparse\tsort\tworkers\tmerge\tinsert\ttotal" << endl;
+   for (int threads = 1; threads <= maxThreads; threads *= 2) {
+       importWithThreads<ArrayADTList<Customer> >("array", filename, threads, chunkBytes);
+       importWithThreads<LinkedADTList<Customer> >("linked", filename, threads, chunkBytes);
+   }
+
+   return 0;
+}
+
+// Function implementations
+
+// Imports the file into an empty list and prints the time spent in each stage
+template <typename List>
+void importWithThreads(const char* label, const std::string& filename, int threads, long long chunkBytes) {
+   List customerList;
+   ParallelImporter<Customer> importer(threads, chunkBytes);
+   try {
+       ParallelImporter<Customer>::Timings timings = importer.importInto(filename, customerList);
+       std::cout << label << "\t" << timings.threads << "\t" << timings.chunks << "\t" << timings.records
+                 << "\t" << timings.splitMs << "\t" << timings.parseMs << "\t" << timings.sortMs
+                 << "\t" << timings.workersMs << "\t" << timings.mergeMs << "\t" << timings.insertMs
+                 << "\t" << timings.totalMs << std::endl;
+   } catch (const std::exception& error) {
+       std::cerr << "Error: " << error.what() << std::endl;
+   }
+}
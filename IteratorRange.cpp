@@ -0,0 +1,23 @@
+#include "IteratorRange.h"
+
+// Constructor: Stores both ends of the range
+template <typename Iterator>
+IteratorRange<Iterator>::IteratorRange(Iterator first, Iterator last) : first(first), last(last) {}
+
+// Begin: Returns the first iterator
+template <typename Iterator>
+Iterator IteratorRange<Iterator>::begin() const {
+   return first;
+}
+
+// End: Returns the last iterator
+template <typename Iterator>
+Iterator IteratorRange<Iterator>::end() const {
+   return last;
+}
+
+// Is empty: Reports whether the two ends meet
+template <typename Iterator>
+bool IteratorRange<Iterator>::isEmpty() const {
+   return !(first != last);
+}
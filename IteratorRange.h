@@ -0,0 +1,50 @@
+#ifndef ITERATOR_RANGE_H
+#define ITERATOR_RANGE_H
+/**
+ * A pair of list iterators that can be walked with a range-based for loop.
+ *
+ * Returned by rangeIterator() on the list classes, so a range query hands back a view
+ * over the items in place instead of a filtered copy of them.
+ *
+ * @param Iterator The iterator type of the list being viewed.
+ */
+template <typename Iterator>
+class IteratorRange {
+public:
+    /**
+     * Constructs a range.
+     *
+     * @param first Iterator at the first item in the range.
+     * @param last Iterator past the last item in the range.
+     */
+    IteratorRange(Iterator first, Iterator last);
+
+    /**
+     * Provides an iterator to the first item in the range.
+     *
+     * @return The first iterator.
+     */
+    Iterator begin() const;
+
+    /**
+     * Provides an iterator past the last item in the range.
+     *
+     * @return The last iterator.
+     */
+    Iterator end() const;
+
+    /**
+     * Determines whether the range holds no items.
+     *
+     * @return True if begin() equals end().
+     */
+    bool isEmpty() const;
+
+private:
+    Iterator first; // The first item in the range.
+    Iterator last;  // One past the last item in the range.
+};
+
+#include "IteratorRange.cpp"
+
+#endif // ITERATOR_RANGE_H
@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "KeyedArrayADTList.h"
+
+// Constructor: Initializes an empty list with INITIAL_CAPACITY slots in every array
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::KeyedArrayADTList()
+   : keys(nullptr), slots(nullptr), payloads(nullptr), holes(nullptr), holeCount(0), used(0), size(0), capacity(0) {
+   relocate(INITIAL_CAPACITY);
+}
+
+// Destructor: Releases every array
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::~KeyedArrayADTList() {
+   delete[] keys;
+   delete[] slots;
+   delete[] payloads;
+   delete[] holes;
+}
+
+// Copy Constructor: Copies the keys, and the items in key order, so the copy has no holes
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::KeyedArrayADTList(const KeyedArrayADTList& other)
+   : keys(nullptr), slots(nullptr), payloads(nullptr), holes(nullptr), holeCount(0), used(0), size(0), capacity(0) {
+   relocate(other.size > INITIAL_CAPACITY ? other.size : INITIAL_CAPACITY);
+   try {
+       for (int i = 0; i < other.size; ++i) {
+           keys[i] = other.keys[i];
+           payloads[i] = other.payloads[other.slots[i]];
+           slots[i] = i;
+       }
+   } catch (...) {
+       delete[] keys; // The destructor will not run, so release the arrays here
+       delete[] slots;
+       delete[] payloads;
+       delete[] holes;
+       throw;
+   }
+   size = other.size;
+   used = other.size;
+}
+
+// Assignment Operator: Copies the other list aside, then swaps it in
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>& KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::operator=(const KeyedArrayADTList& other) {
+   if (this != &other) { // Check for self-assignment
+       KeyedArrayADTList copy(other);
+       swap(copy); // The old arrays are released when copy goes out of scope
+   }
+   return *this;
+}
+
+// Move Constructor: Takes over the other list's arrays
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::KeyedArrayADTList(KeyedArrayADTList&& other) noexcept
+   : keys(other.keys), slots(other.slots), payloads(other.payloads), holes(other.holes), holeCount(other.holeCount),
+     used(other.used), size(other.size), capacity(other.capacity), search(std::move(other.search)) {
+   other.keys = nullptr; // The other list will allocate again if it is reused
+   other.slots = nullptr;
+   other.payloads = nullptr;
+   other.holes = nullptr;
+   other.holeCount = 0;
+   other.used = 0;
+   other.size = 0;
+   other.capacity = 0;
+   other.search.invalidate();
+}
+
+// Move Assignment Operator: Releases this list's arrays and takes over the other list's
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>& KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::operator=(KeyedArrayADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       KeyedArrayADTList taken(std::move(other));
+       swap(taken); // The old arrays are released when taken goes out of scope
+   }
+   return *this;
+}
+
+// Swap: Exchanges the arrays of this list with another list
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::swap(KeyedArrayADTList& other) noexcept {
+   std::swap(keys, other.keys);
+   std::swap(slots, other.slots);
+   std::swap(payloads, other.payloads);
+   std::swap(holes, other.holes);
+   std::swap(holeCount, other.holeCount);
+   std::swap(used, other.used);
+   std::swap(size, other.size);
+   std::swap(capacity, other.capacity);
+   std::swap(search, other.search);
+}
+
+// Get length: Returns the number of items in the list
+template <class DataType, class KeyOf, class SearchPolicy>
+int KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::getLength() const {
+   return size;
+}
+
+// Get capacity: Returns the length of every array
+template <class DataType, class KeyOf, class SearchPolicy>
+int KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::getCapacity() const {
+   return capacity;
+}
+
+// Reserve: Grows every array to at least the requested capacity
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::reserve(int newCapacity) {
+   if (newCapacity > capacity) {
+       relocate(newCapacity);
+   }
+}
+
+// Shrink to fit: Reallocates every array to exactly the current size, which also closes the holes
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::shrinkToFit() {
+   relocate(size);
+}
+
+// Next capacity: Doubles the capacity, clamping to the largest representable size
+template <class DataType, class KeyOf, class SearchPolicy>
+int KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::nextCapacity() const {
+   if (capacity < INITIAL_CAPACITY) {
+       return INITIAL_CAPACITY;
+   }
+   return capacity > INT_MAX / 2 ? INT_MAX : capacity * 2;
+}
+
+// Relocate: Fills new arrays before touching the old ones, then swaps them in
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::relocate(int newCapacity) {
+   std::unique_ptr<Key[]> newKeys(new Key[newCapacity]);
+   std::unique_ptr<int[]> newSlots(new int[newCapacity]);
+   std::unique_ptr<DataType[]> newPayloads(new DataType[newCapacity]);
+   std::unique_ptr<int[]> newHoles(new int[newCapacity]);
+   std::copy(keys, keys + size, newKeys.get()); // Before any payload moves, so a throwing key copy loses nothing
+   for (int i = 0; i < size; ++i) {
+       if constexpr (std::is_nothrow_move_assignable<DataType>::value) {
+           newPayloads[i] = std::move(payloads[slots[i]]);
+       } else {
+           newPayloads[i] = payloads[slots[i]]; // A throwing move could leave items behind in both arrays
+       }
+       newSlots[i] = i;
+   }
+
+   delete[] keys;
+   delete[] slots;
+   delete[] payloads;
+   delete[] holes;
+   keys = newKeys.release();
+   slots = newSlots.release();
+   payloads = newPayloads.release();
+   holes = newHoles.release();
+   holeCount = 0;
+   used = size;
+   capacity = newCapacity;
+}
+
+// Locate: Asks the search policy for the lower bound, then checks that its key matches
+template <class DataType, class KeyOf, class SearchPolicy>
+int KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::locate(const Key& key) const {
+   int index = search.lowerBound(keys, size, key);
+   return (index < size && KeyOrdering::equal(keys[index], key)) ? index : -1;
+}
+
+// Upper index: Uses the vector kernel for naturally ordered arithmetic keys and std::upper_bound otherwise
+template <class DataType, class KeyOf, class SearchPolicy>
+int KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::upperIndex(const Key& key) const {
+   if constexpr (std::is_arithmetic<Key>::value && KeyOrdering::NATURAL) {
+       return SimdSearch::upperBound(keys, size, key);
+   } else {
+       return static_cast<int>(std::upper_bound(keys, keys + size, key, KeyLess()) - keys);
+   }
+}
+
+// Insert item to the list: Copies the item into place
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::putItem(const DataType& item) {
+   insertItem(item);
+}
+
+// Insert item to the list: Moves the item into place
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::putItem(DataType&& item) {
+   insertItem(std::move(item));
+}
+
+// Emplace item: Builds the item from args, then moves it into place
+template <class DataType, class KeyOf, class SearchPolicy>
+template <typename... Args>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::emplaceItem(Args&&... args) {
+   insertItem(DataType(std::forward<Args>(args)...));
+}
+
+// Insert item: Stores the item in a free slot, then shifts only the larger keys and their slot numbers
+template <class DataType, class KeyOf, class SearchPolicy>
+template <typename Item>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::insertItem(Item&& item) {
+   if (holeCount == 0 && used == capacity) {
+       const DataType* address = &item;
+       if (std::less_equal<const DataType*>()(payloads, address) && std::less<const DataType*>()(address, payloads + capacity)) {
+           // Relocating frees the payloads the item lives in, so copy it out first
+           DataType held(static_cast<const DataType&>(item));
+           insertItem(std::move(held));
+           return;
+       }
+       relocate(nextCapacity()); // Every slot holds an item, so size == capacity
+   }
+   Key key(KeyOf()(item)); // Taken before the item is moved from
+   int slot = holeCount > 0 ? holes[holeCount - 1] : used;
+   payloads[slot] = std::forward<Item>(item);
+   if (holeCount > 0) {
+       holeCount--;
+   } else {
+       used++;
+   }
+
+   int i = upperIndex(key); // After any equal keys
+   if constexpr (std::is_trivially_copyable<Key>::value) {
+       std::memmove(static_cast<void*>(keys + i + 1), keys + i, (size - i) * sizeof(Key));
+   } else {
+       std::move_backward(keys + i, keys + size, keys + size + 1);
+   }
+   std::memmove(slots + i + 1, slots + i, (size - i) * sizeof(int));
+   keys[i] = std::move(key);
+   slots[i] = slot;
+   size++;
+   search.inserted(keys, size, i);
+}
+
+// Insert items: Stores the batch, sorts its keys, and merges them into the key array from the back
+template <class DataType, class KeyOf, class SearchPolicy>
+template <typename InputIterator>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::putItems(InputIterator first, InputIterator last) {
+   std::vector<DataType> batch(first, last);
+   int count = static_cast<int>(batch.size());
+   if (count == 0) {
+       return;
+   }
+   if (count > capacity - size) {
+       relocate(std::max(size + count, nextCapacity()));
+   }
+
+   std::vector<std::pair<Key, int> > added; // Each new key and the slot its item went to
+   added.reserve(count);
+   try {
+       for (DataType& item : batch) {
+           int slot = holeCount > 0 ? holes[holeCount - 1] : used;
+           Key key(KeyOf()(item));
+           payloads[slot] = std::move(item);
+           if (holeCount > 0) {
+               holeCount--;
+           } else {
+               used++;
+           }
+           added.emplace_back(std::move(key), slot);
+       }
+   } catch (...) {
+       for (const std::pair<Key, int>& entry : added) {
+           holes[holeCount++] = entry.second; // Hand the slots back; the keys were never linked in
+       }
+       throw;
+   }
+   std::stable_sort(added.begin(), added.end(), [](const std::pair<Key, int>& a, const std::pair<Key, int>& b) {
+       return KeyOrdering::less(a.first, b.first);
+   });
+
+   int i = size - 1;  // Next existing key to place, from the back
+   int j = count - 1; // Next new key to place, from the back
+   for (int k = size + count - 1; j >= 0; --k) {
+       if (i >= 0 && KeyOrdering::less(added[j].first, keys[i])) { // New keys go after equal existing ones
+           keys[k] = std::move(keys[i]);
+           slots[k] = slots[i];
+           --i;
+       } else {
+           keys[k] = std::move(added[j].first);
+           slots[k] = added[j].second;
+           --j;
+       }
+   }
+   size += count;
+   search.invalidate();
+}
+
+// Retrieve an item: Searches the key array for the item's key
+template <class DataType, class KeyOf, class SearchPolicy>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::getItem(const DataType& item, DataType& found_item) const {
+   return findKey(KeyOf()(item), found_item);
+}
+
+// Retrieve an item by key: Converts the key once, then searches as for a whole item
+template <class DataType, class KeyOf, class SearchPolicy>
+template <typename KeyType>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::getItem(const KeyType& key, DataType& found_item) const {
+   return findKey(static_cast<const Key&>(key), found_item);
+}
+
+// Find key: Reads the item only once its key has matched
+template <class DataType, class KeyOf, class SearchPolicy>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::findKey(const Key& key, DataType& found_item) const {
+   int index = locate(key);
+   if (index == -1) {
+       return false;
+   }
+   found_item = payloads[slots[index]];
+   return true;
+}
+
+// Make list empty: Forgets every key and slot, keeping the arrays but releasing the items, as deleteItem does
+template <class DataType, class KeyOf, class SearchPolicy>
+void KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::makeEmpty() {
+   for (int i = 0; i < size; ++i) {
+       payloads[slots[i]] = DataType(); // Freed slots were already released by deleteItem
+   }
+   size = 0;
+   used = 0;
+   holeCount = 0;
+   search.invalidate();
+}
+
+// Delete an item: Frees the item's slot, then closes the gap in the key array
+template <class DataType, class KeyOf, class SearchPolicy>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::deleteItem(const DataType& item) {
+   int i = locate(KeyOf()(item));
+   if (i == -1) {
+       return false;
+   }
+   search.erasing(keys, size, i);
+   int slot = slots[i];
+   payloads[slot] = DataType(); // Release whatever the item holds now rather than when the slot is reused
+   holes[holeCount++] = slot;
+   if constexpr (std::is_trivially_copyable<Key>::value) {
+       std::memmove(static_cast<void*>(keys + i), keys + i + 1, (size - i - 1) * sizeof(Key));
+   } else {
+       std::move(keys + i + 1, keys + size, keys + i);
+   }
+   std::memmove(slots + i, slots + i + 1, (size - i - 1) * sizeof(int));
+   size--;
+   return true;
+}
+
+// Is full: The arrays grow as needed
+template <class DataType, class KeyOf, class SearchPolicy>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::isFull() const {
+   return false;
+}
+
+// Lower bound: Asks the search policy for the first key not less than the item's
+template <class DataType, class KeyOf, class SearchPolicy>
+typename KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::lowerBound(const DataType& item) const {
+   return Iterator(this, search.lowerBound(keys, size, KeyOf()(item)));
+}
+
+// Begin: Returns an iterator at the smallest key
+template <class DataType, class KeyOf, class SearchPolicy>
+typename KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::begin() const {
+   return Iterator(this, 0);
+}
+
+// End: Returns an iterator past the largest key
+template <class DataType, class KeyOf, class SearchPolicy>
+typename KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::end() const {
+   return Iterator(this, size);
+}
+
+// Iterator Constructor: Starts at a position in the key array
+template <class DataType, class KeyOf, class SearchPolicy>
+KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator::Iterator(const KeyedArrayADTList* myList, int index)
+   : myList(myList), index(index) {}
+
+// Iterator Dereference Operator: Follows the key's slot number to its item
+template <class DataType, class KeyOf, class SearchPolicy>
+const DataType& KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator::operator*() const {
+   if (index >= myList->size) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator is at the end of the list.");
+   }
+   return myList->payloads[myList->slots[index]];
+}
+
+// Iterator Pre-increment Operator: Moves to the next key
+template <class DataType, class KeyOf, class SearchPolicy>
+typename KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator& KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator::operator++() {
+   if (index >= myList->size) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator is at the end of the list.");
+   }
+   ++index;
+   return *this;
+}
+
+// Iterator Equality Comparison: Checks if two iterators are at the same position of the same list
+template <class DataType, class KeyOf, class SearchPolicy>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator::operator==(const Iterator& other) const {
+   return myList == other.myList && index == other.index;
+}
+
+// Iterator Inequality Comparison: Checks if two iterators are at different positions
+template <class DataType, class KeyOf, class SearchPolicy>
+bool KeyedArrayADTList<DataType, KeyOf, SearchPolicy>::Iterator::operator!=(const Iterator& other) const {
+   return !(*this == other);
+}
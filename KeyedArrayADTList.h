@@ -0,0 +1,327 @@
+#ifndef KEYED_ARRAY_ADT_LIST_H
+#define KEYED_ARRAY_ADT_LIST_H
+#include <stdexcept>
+#include "ListOrdering.h"
+#include "SearchPolicies.h"
+/**
+ * A sorted, array-backed implementation of an Abstract Data Type (ADT) List that stores its
+ * items' keys apart from the items themselves (a structure-of-arrays layout).
+ *
+ * This class has the same interface as ArrayADTList, but instead of one buffer of whole
+ * items it keeps three parallel arrays:
+ *   keys      Every item's key, densely packed and sorted. All searching happens here.
+ *   slots     For each key, the slot in payloads holding its item.
+ *   payloads  The items themselves, in the order they were stored, not sorted.
+ * A lookup therefore only brings keys into cache, so a binary search over large records such
+ * as Customer touches a few cache lines of integers instead of a few whole records, and an
+ * insert or delete shifts only keys and slot numbers; the item itself is never moved.
+ * Slots freed by deletes are reused by later inserts. Growing, shrinkToFit and copying lay
+ * the payloads out in sorted order again, so iteration stays close to sequential.
+ *
+ * @param DataType The type of data stored in the list; it must be default constructible.
+ * @param KeyOf A default-constructible function object that returns an item's key, such as
+ *              KeyFrom<&Customer::getId>; see ListOrdering.h.
+ * @param SearchPolicy How the key array is searched, and what the keys are sorted by; any policy
+ *                     from SearchPolicies.h instantiated with the key type. By default the
+ *                     vectorized search for arithmetic keys, binary search otherwise.
+ */
+template <class DataType, class KeyOf,
+          class SearchPolicy = DefaultSearchPolicy<typename KeyOrder<DataType, KeyOf>::Key> >
+class KeyedArrayADTList {
+public:
+    typedef typename KeyOrder<DataType, KeyOf>::Key Key;
+    typedef typename SearchPolicy::Order KeyOrdering; // How keys are compared; an ordering policy over Key.
+
+    /**
+     * Adapts KeyOrdering for use as a comparator.
+     */
+    struct KeyLess {
+        bool operator()(const Key& a, const Key& b) const { return KeyOrdering::less(a, b); }
+    };
+
+    typedef KeyOrder<DataType, KeyOf, KeyLess> Order; // How items are compared, through their keys.
+
+private:
+    static const int INITIAL_CAPACITY = 100;
+
+    Key* keys;          // The keys of the items, sorted; the first size are in use.
+    int* slots;         // slots[i] is the position in payloads of the item whose key is keys[i].
+    DataType* payloads; // The items, in no particular order; freed positions are listed in holes.
+    int* holes;         // Positions in payloads freed by deletes, used as a stack.
+    int holeCount;      // Number of positions in holes.
+    int used;           // Positions in payloads handed out so far, holes included.
+    int size;           // Tracks the number of elements in the list.
+    int capacity;       // Length of every array.
+    SearchPolicy search; // Locates keys and owns any index built over the key array.
+
+    /**
+     * Moves the keys and items into new arrays, laying the items out in sorted order. Items
+     * are copied instead if moving them could throw, so a failure leaves the list unchanged.
+     *
+     * @param newCapacity The number of items the new arrays can hold; at least size.
+     */
+    void relocate(int newCapacity);
+
+    /**
+     * Computes the capacity the arrays grow to when they run out of room.
+     *
+     * @return Twice the current capacity, or INITIAL_CAPACITY if the list has none.
+     */
+    int nextCapacity() const;
+
+    /**
+     * Finds the item with the given key.
+     *
+     * @param key The key to look for.
+     * @return The index of the first key equal to key, or -1 if there is none.
+     */
+    int locate(const Key& key) const;
+
+    /**
+     * Finds the first position in the key array whose key is greater than the given key.
+     *
+     * @param key The key to compare against.
+     * @return The position found, or size if there is none.
+     */
+    int upperIndex(const Key& key) const;
+
+    /**
+     * Looks for an item by its key.
+     *
+     * @param key The key to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool findKey(const Key& key, DataType& found_item) const;
+
+    /**
+     * Stores an item in a free payload slot, then opens a gap in the key array after any
+     * equal keys and places its key there.
+     *
+     * @param item The item to insert, copied or moved depending on how it was passed.
+     */
+    template <typename Item>
+    void insertItem(Item&& item);
+
+public:
+    /**
+     * Iterator class for traversing the list in sorted order.
+     */
+    class Iterator;
+
+    /**
+     * Constructs an empty list.
+     */
+    KeyedArrayADTList();
+
+    /**
+     * Destroys the list and releases its arrays.
+     */
+    ~KeyedArrayADTList();
+
+    /**
+     * Constructs a copy of another list.
+     *
+     * @param other The list to duplicate.
+     */
+    KeyedArrayADTList(const KeyedArrayADTList& other);
+
+    /**
+     * Assigns another list's contents to this one.
+     *
+     * @param other The list to assign.
+     * @return A reference to this list.
+     */
+    KeyedArrayADTList& operator=(const KeyedArrayADTList& other);
+
+    /**
+     * Takes over another list's arrays without copying any items.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     */
+    KeyedArrayADTList(KeyedArrayADTList&& other) noexcept;
+
+    /**
+     * Releases this list's arrays and takes over another list's.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     * @return A reference to this list.
+     */
+    KeyedArrayADTList& operator=(KeyedArrayADTList&& other) noexcept;
+
+    /**
+     * Exchanges the contents of this list with another in constant time.
+     *
+     * @param other The list to swap with.
+     */
+    void swap(KeyedArrayADTList& other) noexcept;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The current size of the list.
+     */
+    int getLength() const;
+
+    /**
+     * Retrieves the number of elements the list can hold before it must grow.
+     *
+     * @return The capacity of the underlying arrays.
+     */
+    int getCapacity() const;
+
+    /**
+     * Ensures the list can hold at least the given number of elements without growing.
+     *
+     * @param newCapacity The minimum capacity to allocate.
+     */
+    void reserve(int newCapacity);
+
+    /**
+     * Releases unused capacity and lays the items out in sorted order again.
+     */
+    void shrinkToFit();
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into place.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Constructs an item from the given arguments and adds it to the list.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     */
+    template <typename... Args>
+    void emplaceItem(Args&&... args);
+
+    /**
+     * Inserts a batch of items, sorting the batch's keys once and merging them with the
+     * current keys from the back, so no key is shifted more than once.
+     *
+     * @param first Iterator to the first item to insert.
+     * @param last Iterator past the last item to insert.
+     */
+    template <typename InputIterator>
+    void putItems(InputIterator first, InputIterator last);
+
+    /**
+     * Searches for an item in the list.
+     *
+     * @param item The value to find; only its key is compared.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Searches for an item by its key alone.
+     *
+     * @param key Anything that converts to Key.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    template <typename KeyType>
+    bool getItem(const KeyType& key, DataType& found_item) const;
+
+    /**
+     * Empties the list, keeping its capacity but releasing what the items held.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete; only its key is compared.
+     * @return True if deleted, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Always false since the arrays grow as needed.
+     */
+    bool isFull() const;
+
+    /**
+     * Finds the first item whose key is not less than the given item's, in O(log n).
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if every item is less.
+     */
+    Iterator lowerBound(const DataType& item) const;
+
+    /**
+     * Provides an iterator to the start of the list.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    Iterator begin() const;
+
+    /**
+     * Provides an iterator to the end of the list.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    Iterator end() const;
+
+    class Iterator {
+    public:
+        /**
+         * Constructs an iterator at a position in the key array.
+         *
+         * @param myList The list being traversed.
+         * @param index The position of the current item's key, or size at the end.
+         */
+        Iterator(const KeyedArrayADTList* myList, int index);
+
+        /**
+         * Accesses the item at the iterator's current position.
+         *
+         * @return Reference to the stored item.
+         * @throw std::out_of_range if the iterator is at the end.
+         */
+        const DataType& operator*() const;
+
+        /**
+         * Moves the iterator to the next item.
+         *
+         * @return Reference to the updated iterator.
+         */
+        Iterator& operator++();
+
+        /**
+         * Compares two iterators for equality.
+         *
+         * @param other The iterator to compare against.
+         * @return True if both point to the same position, otherwise false.
+         */
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * Checks if two iterators are different.
+         *
+         * @param other The iterator to compare against.
+         * @return True if they differ, otherwise false.
+         */
+        bool operator!=(const Iterator& other) const;
+
+    private:
+        const KeyedArrayADTList* myList; // Pointer to the list.
+        int index;                       // Position in the key array.
+    };
+};
+
+#include "KeyedArrayADTList.cpp"
+
+#endif // KEYED_ARRAY_ADT_LIST_H
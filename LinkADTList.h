@@ -1,6 +1,16 @@
 #ifndef LINKED_ADT_LIST_H
 #define LINKED_ADT_LIST_H
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "IteratorRange.h"
+#include "ListOrdering.h"
+#include "ListSnapshot.h"
+#include "ListStats.h"
+#include "NodeAllocators.h"
+#include "NodeIndexes.h"
 /**
  * A linked list implementation of an Abstract Data Type (ADT) List.
  *
@@ -9,33 +19,210 @@
  * iterating through the list.
  *
  * @param DataType The type of data stored in the list.
+ * @param NodeAllocator Where node storage comes from; see NodeAllocators.h.
+ * @param StatsPolicy What the hot paths record; NoStats by default, see ListStats.h.
+ * @param NodeIndex Whether getItem and deleteItem can skip the walk; see NodeIndexes.h.
+ * @param Order What the items are sorted by; NaturalOrder by default, see ListOrdering.h.
  */
-template <class DataType>
+template <class DataType, template <class> class NodeAllocator = HeapNodeAllocator, class StatsPolicy = NoStats,
+          template <class> class NodeIndex = NoNodeIndex, class Order = NaturalOrder<DataType> >
 class LinkedADTList {
+public:
+    typedef typename Order::Key Key; // What the items are sorted by
+
 private:
+    struct NoKey {};
+
+    struct HeldKey {
+        Key cachedKey; // Order::key(value), kept so walks compare it without loading the value.
+    };
+
     /**
-     * Node structure for storing data and the next pointer.
+     * Node structure for storing data and the next pointer. With a CachedKeyOrder the node
+     * also holds the value's key, which comes first so that it shares a cache line with next.
      */
-    struct Node {
-        DataType value;
+    struct Node : std::conditional<Order::CACHED, HeldKey, NoKey>::type {
+        typedef Order OrderPolicy; // Lets the node index hash and match keys.
+
         Node* next;
+        DataType value;
+
+        /**
+         * Provides the key the node is sorted by: the cached copy if there is one.
+         *
+         * @return The key, by value if cached, otherwise as Order::key returns it.
+         */
+        decltype(auto) getKey() const {
+            if constexpr (Order::CACHED) {
+                return this->cachedKey;
+            } else {
+                return Order::key(value);
+            }
+        }
+
+        /**
+         * Recomputes the cached key after the value has been constructed or assigned.
+         */
+        void refreshKey() {
+            if constexpr (Order::CACHED) {
+                this->cachedKey = Order::key(value);
+            }
+        }
+    };
+
+    /**
+     * Compares two nodes by key.
+     *
+     * @param a The node that may come first.
+     * @param b The node to compare against.
+     * @return True if a's key sorts before b's.
+     */
+    static bool precedes(const Node* a, const Node* b) { return Order::less(a->getKey(), b->getKey()); }
+
+    /**
+     * Nodes handed over by snapshot(), which are never written again. A run owns the nodes from
+     * first up to stop, where its last node links into the next older run.
+     */
+    struct FrozenRun {
+        Node* first;                      // First node this run owns.
+        Node* stop;                       // First node of the older run, or nullptr.
+        std::shared_ptr<FrozenRun> older; // Keeps the nodes this run links into alive.
+
+        /**
+         * Takes ownership of the nodes from first up to stop.
+         *
+         * @param first The first node of the run.
+         * @param stop The node after the last one, owned by older.
+         * @param older The run that stop belongs to.
+         */
+        FrozenRun(Node* first, Node* stop, std::shared_ptr<FrozenRun> older);
+
+        /**
+         * Frees the run's nodes, and any older runs nothing else holds.
+         */
+        ~FrozenRun();
     };
 
     Node* head; // Pointer to the first node in the list.
     int size;   // Tracks the number of elements in the list.
+    [[no_unique_address]] mutable StatsPolicy stats; // Updated by const lookups too; takes no space when empty.
+    NodeAllocator<Node> nodes; // Supplies and reclaims node storage.
+    NodeIndex<Node> index;     // Maps items to the links pointing at their nodes, if enabled.
+    Node* frozen;              // First node shared with a View; it and every node after it are read-only.
+    std::shared_ptr<FrozenRun> frozenRun; // Owns the shared nodes while the list still links to them.
 
     /**
-     * Copies another list's contents into this one.
+     * Allocates a node and constructs its value from the given arguments.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     * @return The new node, not yet linked into the list.
+     */
+    template <typename... Args>
+    Node* createNode(Args&&... args);
+
+    /**
+     * Destroys a node's value and returns its storage to the allocator.
+     *
+     * @param node The node to free.
+     */
+    void destroyNode(Node* node);
+
+    /**
+     * Copies another list's contents into this one, assigning over the values of the nodes
+     * this list already has and allocating or freeing only the difference in length.
      *
      * @param other The list to be copied.
      */
     void deepCopy(const LinkedADTList& other);
 
+    /**
+     * Frees every node from a link onward and sets the size.
+     *
+     * @param link The link to cut; it is set to nullptr.
+     * @param kept The number of nodes before link.
+     */
+    void truncate(Node** link, int kept);
+
     /**
      * Deallocates memory and resets the list.
      */
     void clear();
 
+    /**
+     * Links an already constructed node into its sorted position, after any equal items.
+     *
+     * @param node The node to insert.
+     */
+    void insertNode(Node* node);
+
+    /**
+     * Takes back the shared nodes of every run no view holds any more, newest first, so later
+     * writes need not copy them. Nodes of such a run that the list has already copied or
+     * deleted are freed with it.
+     */
+    void reclaim();
+
+    /**
+     * Copies the shared nodes from the first one through last, in place, so their links can change.
+     *
+     * @param boundary The link to the first shared node.
+     * @param last A shared node at or after it.
+     * @return The link in the copy of last, which points at the node after it.
+     */
+    Node** thaw(Node** boundary, Node* last);
+
+    /**
+     * Walks past every node whose value the predicate accepts, copying any shared nodes
+     * it walks over so that the link it stops at can be written.
+     *
+     * @param accepts Called with each node; the walk stops at the first it rejects.
+     * @param walked Incremented once per node walked past.
+     * @return The link after the last accepted node.
+     */
+    template <typename Predicate>
+    Node** writableLink(Predicate accepts, long long& walked);
+
+    /**
+     * Copies every shared node, so the whole list can be relinked.
+     */
+    void thawAll();
+
+    /**
+     * Stably sorts the first count nodes of a chain.
+     *
+     * @param chain The chain to take nodes from; advanced past the nodes taken.
+     * @param count How many nodes to take; must be at least 1.
+     * @return The sorted nodes, ending in nullptr.
+     */
+    static Node* sortChain(Node*& chain, int count);
+
+    /**
+     * Walks forward to the first node whose key is not less than key.
+     *
+     * @param from The node to start at.
+     * @param key The key to compare against.
+     * @return The node found, or nullptr.
+     */
+    static Node* firstNotLess(Node* from, const Key& key);
+
+    /**
+     * Walks forward to the first node whose key is greater than key.
+     *
+     * @param from The node to start at.
+     * @param key The key to compare against.
+     * @return The node found, or nullptr.
+     */
+    static Node* firstGreater(Node* from, const Key& key);
+
+    /**
+     * Looks for the node with the given key, through the index if there is one.
+     *
+     * @param key The key to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool findKey(const Key& key, DataType& found_item) const;
+
 public:
     /**
      * Constructs an empty linked list.
@@ -62,6 +249,28 @@ public:
      */
     LinkedADTList& operator=(const LinkedADTList& other);
 
+    /**
+     * Takes over another list's nodes without copying them.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     */
+    LinkedADTList(LinkedADTList&& other) noexcept;
+
+    /**
+     * Releases this list's nodes and takes over another list's.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     * @return A reference to this list.
+     */
+    LinkedADTList& operator=(LinkedADTList&& other) noexcept;
+
+    /**
+     * Exchanges the contents of this list with another in constant time.
+     *
+     * @param other The list to swap with.
+     */
+    void swap(LinkedADTList& other) noexcept;
+
     /**
      * Retrieves the number of elements in the list.
      *
@@ -76,6 +285,60 @@ public:
      */
     void putItem(const DataType& item);
 
+    /**
+     * Adds an item to the list, moving it into the new node.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Constructs an item directly inside a new node and adds it to the list.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     */
+    template <typename... Args>
+    void emplaceItem(Args&&... args);
+
+    /**
+     * Adds a range of items in one pass over the list. The new nodes are chained together,
+     * sorted if they are not already in order, and then merged into the list in a single walk,
+     * instead of walking from the head once per item. Pass move iterators to move items in.
+     *
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    template <typename InputIt>
+    void putItems(InputIt first, InputIt last);
+
+    /**
+     * Moves every node of another sorted list into this one in a single merge pass, relinking
+     * the nodes rather than copying their values. An item held by both lists is kept once per
+     * copy in the longer run, as with std::set_union, and the other list's spare copies are freed.
+     * There is no galloping mode as on ArrayADTList: a linked list cannot skip ahead faster than
+     * it walks, so the pass instead stops as soon as either list runs out. Every comparison is
+     * made before either list changes, so both are left unchanged if one throws.
+     *
+     * @param other The list to take nodes from; it is left empty.
+     */
+    void unionWith(LinkedADTList& other);
+
+    /**
+     * Unlinks and frees every node whose item the other sorted list does not also hold, in a
+     * single merge pass. Duplicates follow std::set_intersection.
+     *
+     * @param other The list to compare against; it is not changed.
+     */
+    void intersectWith(const LinkedADTList& other);
+
+    /**
+     * Unlinks and frees one node for each matching item in the other sorted list, in a single
+     * merge pass. Duplicates follow std::set_difference.
+     *
+     * @param other The list of items to remove; it is not changed.
+     */
+    void subtract(const LinkedADTList& other);
+
     /**
      * Searches for an item in the list.
      *
@@ -85,6 +348,16 @@ public:
      */
     bool getItem(const DataType& item, DataType& found_item) const;
 
+    /**
+     * Searches for an item by its key alone, so a list ordered by ID can be searched with just the ID.
+     *
+     * @param key Anything that converts to Key.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    template <typename KeyType>
+    bool getItem(const KeyType& key, DataType& found_item) const;
+
     /**
      * Empties the list, removing all elements.
      */
@@ -98,6 +371,35 @@ public:
      */
     bool deleteItem(const DataType& item);
 
+    /**
+     * Writes the sorted contents to a binary snapshot; see ListSnapshot.h for the format.
+     *
+     * @param path The file to create or replace.
+     * @throw SnapshotError if the file cannot be written.
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * Replaces the contents with a snapshot written by save(). The items are already in order,
+     * so each node is appended at the tail instead of being inserted in sorted position.
+     *
+     * @param path The snapshot file.
+     * @throw SnapshotError if the file is not a valid snapshot of DataType; the list is left unchanged.
+     */
+    void load(const std::string& path);
+
+    /**
+     * Provides the statistics recorded by the stats policy.
+     *
+     * @return The policy, whose toJson() formats everything it has recorded.
+     */
+    const StatsPolicy& getStats() const;
+
+    /**
+     * Sets the recorded statistics back to zero.
+     */
+    void resetStats();
+
     /**
      * Determines if the list is full.
      *
@@ -106,7 +408,29 @@ public:
     bool isFull() const;
 
     /**
-     * Iterator class for traversing the list.
+     * Read-only view of the list's contents at the moment snapshot() was called.
+     */
+    class View;
+
+    /**
+     * Takes a read-only view of the current contents in O(1), without copying any nodes.
+     * The view shares the nodes; a later change copies only the shared nodes in front of the
+     * position it changes (path copying) and keeps sharing the rest, so the view never sees it.
+     * Once every view of them has been released, the list takes the shared nodes back on its
+     * next change instead of copying them.
+     * Views may be read and released on other threads while the list changes.
+     *
+     * Shared nodes are freed by whichever holder lets go last, so the allocator must be able
+     * to free nodes one at a time, after the list is gone; NodePool cannot.
+     *
+     * @return A view of the items as they are now.
+     */
+    View snapshot();
+
+    /**
+     * Iterator class for traversing the list. Items are read-only through it: a write could
+     * reach a node a view still shares, bypass the side index and leave a cached key stale,
+     * so change an item by deleting it and putting the new value.
      */
     class Iterator {
     public:
@@ -121,9 +445,9 @@ public:
         /**
          * Accesses the value at the iterator's current position.
          *
-         * @return Reference to the stored data.
+         * @return Const reference to the stored data.
          */
-        DataType& operator*() const;
+        const DataType& operator*() const;
 
         /**
          * Moves the iterator to the next node.
@@ -166,6 +490,160 @@ public:
      * @return Iterator pointing past the last element.
      */
     Iterator end();
+
+    /**
+     * Finds the first item that is not less than the given item, stopping there
+     * instead of walking the rest of the list.
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if every item is less.
+     */
+    Iterator lowerBound(const DataType& item);
+
+    /**
+     * Finds the first item that is greater than the given item.
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if no item is greater.
+     */
+    Iterator upperBound(const DataType& item);
+
+    /**
+     * Finds every item equal to the given item, stopping right after the last one.
+     *
+     * @param item The value to compare against.
+     * @return The lowerBound and upperBound of item; they are equal if item is absent.
+     */
+    std::pair<Iterator, Iterator> equalRange(const DataType& item);
+
+    /**
+     * Provides the items between two bounds, inclusive, without copying them.
+     * The walk stops after the last item not greater than hi.
+     *
+     * @param lo The smallest item to include.
+     * @param hi The largest item to include.
+     * @return A range that can be used in a range-based for loop; empty if hi is less than lo.
+     */
+    IteratorRange<Iterator> rangeIterator(const DataType& lo, const DataType& hi);
+
+    class View {
+    public:
+        /**
+         * Iterator class for traversing a view, or a const list through ConstIterator.
+         */
+        class Iterator {
+        public:
+            /**
+             * Constructs an iterator at a node of the view.
+             *
+             * @param current Pointer to the current node.
+             */
+            explicit Iterator(const Node* current);
+
+            /**
+             * Accesses the value at the iterator's current position.
+             *
+             * @return Reference to the stored data.
+             * @throw std::out_of_range if the iterator is at the end.
+             */
+            const DataType& operator*() const;
+
+            /**
+             * Moves the iterator to the next node.
+             *
+             * @return Reference to the updated iterator.
+             * @throw std::out_of_range if the iterator is at the end.
+             */
+            Iterator& operator++();
+
+            /**
+             * Compares two iterators for equality.
+             *
+             * @param other The iterator to compare against.
+             * @return True if both point to the same position, otherwise false.
+             */
+            bool operator==(const Iterator& other) const;
+
+            /**
+             * Checks if two iterators are different.
+             *
+             * @param other The iterator to compare against.
+             * @return True if they differ, otherwise false.
+             */
+            bool operator!=(const Iterator& other) const;
+
+        private:
+            const Node* current; // Pointer to the current node.
+        };
+
+        /**
+         * Constructs an empty view.
+         */
+        View();
+
+        /**
+         * Retrieves the number of elements in view.
+         *
+         * @return The length of the list when the view was taken.
+         */
+        int getLength() const;
+
+        /**
+         * Searches the view for an item.
+         *
+         * @param item The value to find.
+         * @param found_item Stores the located item if found.
+         * @return True if the item was in the list when the view was taken, otherwise false.
+         */
+        bool getItem(const DataType& item, DataType& found_item) const;
+
+        /**
+         * Provides an iterator to the start of the view.
+         *
+         * @return Iterator pointing to the first element.
+         */
+        Iterator begin() const;
+
+        /**
+         * Provides an iterator to the end of the view.
+         *
+         * @return Iterator pointing past the last element.
+         */
+        Iterator end() const;
+
+    private:
+        /**
+         * Constructs a view of a chain of shared nodes.
+         *
+         * @param run The newest run the chain starts in.
+         * @param head The first node of the chain.
+         * @param size The number of nodes in the chain.
+         */
+        View(std::shared_ptr<const FrozenRun> run, const Node* head, int size);
+
+        friend class LinkedADTList;
+
+        std::shared_ptr<const FrozenRun> run; // Keeps every node of the chain alive.
+        const Node* head;                     // Pointer to the first node in view.
+        int size;                             // Number of nodes in view.
+    };
+
+    typedef typename View::Iterator ConstIterator; // Read-only iterator over the list's own nodes.
+
+    /**
+     * Provides a read-only iterator to the start of a const list, so a const list can be
+     * traversed the same way as a const ArrayADTList.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * Provides a read-only iterator to the end of a const list.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    ConstIterator end() const;
 };
 
 #include "LinkedADTList.cpp"
@@ -1,173 +1,738 @@
+#include <atomic>
+#include <climits>
 #include <iostream>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "LinkedADTList.h"
 
 // Constructor: Initializes an empty linked list
-template <class DataType>
-LinkedADTList<DataType>::LinkedADTList() {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::LinkedADTList() {
    head = nullptr; // Set head to nullptr (empty list)
    size = 0; // Initialize size to 0
+   frozen = nullptr; // No node is shared yet
 }
 
 // Destructor: Clears the list to free memory
-template <class DataType>
-LinkedADTList<DataType>::~LinkedADTList() {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::~LinkedADTList() {
    clear(); // Call the clear function to delete all nodes
 }
 
 // Copy Constructor: Creates a deep copy of another list
-template <class DataType>
-LinkedADTList<DataType>::LinkedADTList(const LinkedADTList& other) {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::LinkedADTList(const LinkedADTList& other) {
+   typename StatsPolicy::Timer timer(stats, STATS_COPY);
    head = nullptr; // Initialize head to nullptr
    size = 0; // Initialize size to 0
-   deepCopy(other); // Perform a deep copy of the other list
+   frozen = nullptr;
+   try {
+       deepCopy(other); // Perform a deep copy of the other list
+   } catch (...) {
+       clear(); // The destructor will not run, so free the partial copy here
+       throw;
+   }
 }
 
 // Assignment Operator: Assigns the contents of another list to this list
-template <class DataType>
-LinkedADTList<DataType>& LinkedADTList<DataType>::operator=(const LinkedADTList& other) {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::operator=(const LinkedADTList& other) {
+   typename StatsPolicy::Timer timer(stats, STATS_COPY);
    if (this != &other) { // Check for self-assignment
-       clear(); // Clear the current list
-       deepCopy(other); // Perform a deep copy of the other list
+       deepCopy(other); // Reuses this list's nodes, so there is nothing to clear first
    }
    return *this; // Return the current object for chaining
 }
 
+// Move Constructor: Takes over the other list's nodes
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::LinkedADTList(LinkedADTList&& other) noexcept
+   : nodes(std::move(other.nodes)), frozenRun(std::move(other.frozenRun)) { // The nodes travel with the storage they came from
+   head = other.head; // Take the other list's chain of nodes
+   size = other.size;
+   frozen = other.frozen;
+   other.head = nullptr; // Leave the other list empty
+   other.size = 0;
+   other.frozen = nullptr;
+   other.index.invalidate(); // Its entries pointed at the other list's head
+}
+
+// Move Assignment Operator: Frees this list's nodes and takes over the other list's
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::operator=(LinkedADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       clear(); // Free the current nodes
+       nodes = std::move(other.nodes); // Take the storage the other list's nodes live in
+       head = other.head; // Take the other list's chain of nodes
+       size = other.size;
+       frozen = other.frozen;
+       frozenRun = std::move(other.frozenRun);
+       other.head = nullptr; // Leave the other list empty
+       other.size = 0;
+       other.frozen = nullptr;
+       other.index.invalidate();
+   }
+   return *this; // Return the current object for chaining
+}
+
+// Swap: Exchanges the nodes of this list with another list
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::swap(LinkedADTList& other) noexcept {
+   std::swap(head, other.head);
+   std::swap(size, other.size);
+   std::swap(nodes, other.nodes);
+   std::swap(frozen, other.frozen);
+   std::swap(frozenRun, other.frozenRun);
+   index.invalidate(); // Entries for the first node point at the head it used to hang from
+   other.index.invalidate();
+}
+
 // Get length: Returns the number of items in the list
-template <class DataType>
-int LinkedADTList<DataType>::getLength() const {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+int LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::getLength() const {
    return size; // Return the size of the list
 }
 
-// Insert item to the list
-template <class DataType>
-void LinkedADTList<DataType>::putItem(const DataType& item) {
-   Node *temp = new Node; // Create a new node
-   temp->value = item; // Set the value of the new node
-   if (head == nullptr) {
-      head = temp;
-      size++;
-      return;
-   }
-   Node* prev = nullptr;
-   Node* curr = head;
-   while (curr != nullptr) {
-      if (curr->value < item) {
-         prev = curr;
-         curr = curr->next;
-      } else {
-         break;
-      }
+// Insert item to the list: Copies the item into a new node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::putItem(const DataType& item) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   insertNode(createNode(item)); // Copy-construct the value inside the node
+}
+
+// Insert item to the list: Moves the item into a new node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::putItem(DataType&& item) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   insertNode(createNode(std::move(item))); // Move-construct the value inside the node
+}
+
+// Emplace item: Constructs the item inside a new node and inserts it
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+template <typename... Args>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::emplaceItem(Args&&... args) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   insertNode(createNode(std::forward<Args>(args)...)); // Construct the value in place
+}
+
+// Insert a range of items: Chains new nodes, sorts the chain if needed, and merges it into the list
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+template <typename InputIt>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::putItems(InputIt first, InputIt last) {
+   typename StatsPolicy::Timer timer(stats, STATS_PUT);
+   typedef typename std::iterator_traits<InputIt>::iterator_category Category;
+   if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+       nodes.reserve(static_cast<int>(std::distance(first, last))); // Let the allocator place the batch in one block
    }
-   if (prev == nullptr) {
-      temp->next = curr;
-      head = temp;
-   } else {
-      temp->next = curr;
-      prev->next = temp;
+
+   Node* batch = nullptr; // New nodes, in the order given
+   Node* tail = nullptr;
+   int count = 0;
+   Node* largest = nullptr;
+   bool sorted = true;
+   long long walked = 0;
+   try {
+       for (; first != last; ++first) {
+           Node* node = createNode(*first);
+           if (tail == nullptr) {
+               batch = node;
+           } else {
+               sorted = sorted && !precedes(node, tail);
+               tail->next = node;
+           }
+           if (largest == nullptr || precedes(largest, node)) {
+               largest = node;
+           }
+           tail = node;
+           count++;
+       }
+       if (frozen != nullptr && largest != nullptr) { // Copy the shared nodes the merge may relink before changing anything
+           writableLink([largest](const Node* node) { return !precedes(largest, node); }, walked);
+       }
+   } catch (...) {
+       while (batch != nullptr) { // Leave the list as it was if a value fails to construct
+           Node* temp = batch;
+           batch = batch->next;
+           destroyNode(temp);
+       }
+       throw;
+   }
+   if (count == 0) {
+       return;
+   }
+   if (!sorted) {
+       Node* chain = batch;
+       batch = sortChain(chain, count);
+   }
+
+   Node** link = &head; // Link that the next new node may be spliced into
+   while (batch != nullptr) {
+       while (*link != nullptr && !precedes(batch, *link)) { // Existing equal items stay in front, as with putItem
+           link = &(*link)->next;
+           walked++;
+       }
+       Node* node = batch;
+       batch = batch->next;
+       node->next = *link;
+       *link = node;
+       link = &node->next;
+   }
+   size += count;
+   stats.addNodesWalked(walked);
+   index.invalidate(); // Rebuilt once, on the next lookup
+}
+
+// Union: Walks both lists once to choose where each of the other list's nodes goes, then relinks them all
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::unionWith(LinkedADTList& other) {
+   if (this == &other) { // A list's union with itself is the list
+       return;
+   }
+   thawAll(); // Nodes shared with a view can be neither relinked nor handed over
+   other.thawAll();
+
+   // Every comparison happens here, before either list changes, so a throwing one leaves both intact.
+   std::vector<Node**> places; // Per node of theirs: the link of ours to splice it at, or nullptr if ours holds it too
+   places.reserve(other.size);
+   Node** link = &head;
+   for (const Node* theirs = other.head; theirs != nullptr; theirs = theirs->next) {
+       while (*link != nullptr && precedes(*link, theirs)) {
+           link = &(*link)->next;
+       }
+       if (*link != nullptr && !precedes(theirs, *link)) { // Held by both, so step past ours and drop theirs
+           places.push_back(nullptr);
+           link = &(*link)->next;
+       } else {
+           places.push_back(link);
+       }
+   }
+
+   index.invalidate();
+   other.index.invalidate();
+   nodes.absorb(other.nodes); // Every node the other list hands over is now ours to free
+   Node* theirs = other.head;
+   other.head = nullptr;
+   other.size = 0;
+   Node** previousPlace = nullptr;
+   Node* previousSpliced = nullptr;
+   for (Node** place : places) {
+       Node* node = theirs;
+       theirs = theirs->next;
+       if (place == nullptr) {
+           destroyNode(node);
+           continue;
+       }
+       Node** at = place == previousPlace ? &previousSpliced->next : place; // Several of theirs can share one gap
+       node->next = *at;
+       *at = node;
+       previousPlace = place;
+       previousSpliced = node;
+       size++;
+   }
+}
+
+// Intersection: Walks both lists once, freeing each of our nodes the other list does not match
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::intersectWith(const LinkedADTList& other) {
+   if (this == &other) { // Every item is held by both
+       return;
+   }
+   thawAll();
+   index.invalidate();
+   const Node* theirs = other.head;
+   Node** link = &head;
+   while (*link != nullptr) {
+       if (theirs == nullptr || precedes(*link, theirs)) { // Unmatched, so unlink it
+           Node* dropped = *link;
+           *link = dropped->next;
+           destroyNode(dropped);
+           size--;
+       } else if (precedes(theirs, *link)) {
+           theirs = theirs->next;
+       } else { // Matched, so keep it and use up the match
+           link = &(*link)->next;
+           theirs = theirs->next;
+       }
+   }
+}
+
+// Difference: Walks both lists once, freeing each of our nodes the other list matches
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::subtract(const LinkedADTList& other) {
+   if (this == &other) { // Every item is removed
+       makeEmpty();
+       return;
+   }
+   thawAll();
+   index.invalidate();
+   const Node* theirs = other.head;
+   Node** link = &head;
+   while (*link != nullptr && theirs != nullptr) { // Stop once the other list runs out
+       if (precedes(*link, theirs)) {
+           link = &(*link)->next;
+       } else if (precedes(theirs, *link)) {
+           theirs = theirs->next;
+       } else { // Matched, so unlink it and use up the match
+           Node* dropped = *link;
+           *link = dropped->next;
+           destroyNode(dropped);
+           size--;
+           theirs = theirs->next;
+       }
+   }
+}
+
+// Sort chain: Merge sorts the first count nodes, taking the left run first on ties to stay stable
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Node* LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::sortChain(Node*& chain, int count) {
+   if (count == 1) {
+       Node* node = chain;
+       chain = chain->next;
+       node->next = nullptr;
+       return node;
+   }
+   Node* left = sortChain(chain, count / 2);
+   Node* right = sortChain(chain, count - count / 2);
+   Node* merged = nullptr;
+   Node** tail = &merged;
+   while (left != nullptr && right != nullptr) {
+       if (precedes(right, left)) {
+           *tail = right;
+           right = right->next;
+       } else {
+           *tail = left;
+           left = left->next;
+       }
+       tail = &(*tail)->next;
    }
+   *tail = (left != nullptr) ? left : right;
+   return merged;
+}
+
+// Insert node: Links the node in front of the first value greater than it, so it follows any equal values
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::insertNode(Node* temp) {
+   long long walked = 0;
+   Node** link;
+   try {
+      link = writableLink([temp](const Node* node) { return !precedes(temp, node); }, walked);
+   } catch (...) {
+      destroyNode(temp); // The node was never linked in
+      throw;
+   }
+   stats.addNodesWalked(walked);
+   temp->next = *link;
+   *link = temp;
+   index.linked(link);
    size++;
 }
 
+// Reclaim: Releases runs only the list still holds, keeping the nodes it links to and freeing the rest with the run
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::reclaim() {
+   while (frozenRun != nullptr && frozenRun.use_count() == 1) {
+       std::atomic_thread_fence(std::memory_order_acquire); // The last view's reads happen before our writes
+       FrozenRun& run = *frozenRun;
+       Node* owned = run.first;
+       while (owned != run.stop && owned != frozen) { // The list links to the run's nodes from frozen on, if any
+           owned = owned->next;
+       }
+       if (owned == frozen && frozen != run.stop) {
+           Node* stop = run.stop;
+           run.stop = frozen; // The run now frees only the nodes before frozen, which the list no longer links to
+           frozen = stop;
+       }
+       std::shared_ptr<FrozenRun> older = std::move(run.older);
+       frozenRun = std::move(older); // Frees the released run and whatever nodes it still owns
+   }
+}
+
+// Thaw: Builds copies of the shared nodes through last on the side, then links them in place of the originals
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Node** LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::thaw(Node** boundary, Node* last) {
+   Node* copies = nullptr;
+   Node** tail = &copies;
+   try {
+      for (const Node* source = *boundary; ; source = source->next) {
+         *tail = createNode(source->value);
+         tail = &(*tail)->next;
+         if (source == last) {
+            break;
+         }
+      }
+   } catch (...) {
+      while (copies != nullptr) { // The list still links to the originals, so it is unchanged
+         Node* temp = copies;
+         copies = copies->next;
+         destroyNode(temp);
+      }
+      throw;
+   }
+   frozen = last->next;
+   *tail = frozen; // Keep sharing everything after last
+   *boundary = copies;
+   index.invalidate(); // Every copied node hangs from a new link
+   if (frozen == nullptr) {
+      frozenRun.reset(); // The list no longer links to any shared node
+   }
+   return tail;
+}
+
+// Writable link: Walks like a search, noting where the shared nodes start, and thaws them if it passed any
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+template <typename Predicate>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Node** LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::writableLink(Predicate accepts, long long& walked) {
+   reclaim(); // Nodes no view can reach any more are the list's to write again
+   Node** link = &head;
+   Node** boundary = nullptr; // Link to the first shared node, once the walk has passed it
+   Node* last = nullptr;
+   while (*link != nullptr && accepts(static_cast<const Node*>(*link))) {
+      if (*link == frozen) {
+         boundary = link;
+      }
+      last = *link;
+      link = &last->next;
+      walked++;
+   }
+   if (boundary != nullptr) {
+      link = thaw(boundary, last); // The link to write is inside a shared node
+   }
+   return link;
+}
+
+// Thaw all: Copies every shared node, leaving nothing shared with any view
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::thawAll() {
+   reclaim();
+   if (frozen != nullptr) {
+      long long walked = 0;
+      writableLink([](const Node*) { return true; }, walked);
+   }
+}
+
 
 // Retrieve an item: Searches for an item in the list and returns it if found
-template <class DataType>
-bool LinkedADTList<DataType>::getItem(const DataType& item, DataType& found_item) const {
-   Node* current = head; // Start at the head of the list
-   while (current != nullptr) { // Traverse the list
-       if (current->value == item) { // Check if the current node's value matches the item
-           found_item = current->value; // Return the found item
-           return true; // Indicate success
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::getItem(const DataType& item, DataType& found_item) const {
+   return findKey(Order::key(item), found_item);
+}
+
+// Retrieve an item by key: Converts the key once, then searches as for a whole item
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+template <typename KeyType>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::getItem(const KeyType& key, DataType& found_item) const {
+   return findKey(static_cast<const Key&>(key), found_item);
+}
+
+// Find key: Asks the index if there is one, and otherwise walks until the key's position
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::findKey(const Key& key, DataType& found_item) const {
+   typename StatsPolicy::Timer timer(stats, STATS_GET);
+   if constexpr (NodeIndex<Node>::ENABLED) {
+       Node** link = index.find(const_cast<Node**>(&head), size, key); // The table only reads the links
+       if (link == nullptr) {
+           return false;
        }
+       found_item = (*link)->value;
+       return true;
+   }
+   Node* current = head; // Start at the head of the list
+   long long walked = 0;
+   while (current != nullptr && Order::less(current->getKey(), key)) { // Traverse the list until the key's position
        current = current->next; // Move to the next node
+       walked++;
+   }
+   stats.addNodesWalked(walked);
+   if (current != nullptr && Order::equal(current->getKey(), key)) { // Check if the current node's key matches
+       found_item = current->value; // Return the found item
+       return true; // Indicate success
    }
    return false; // Indicate the item was not found
 }
 
+// Lower bound: Walks only as far as the first value not less than item
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::lowerBound(const DataType& item) {
+   return Iterator(this, firstNotLess(head, Order::key(item)));
+}
+
+// Upper bound: Walks only as far as the first value greater than item
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::upperBound(const DataType& item) {
+   return Iterator(this, firstGreater(head, Order::key(item)));
+}
+
+// Equal range: Finds the lower bound, then continues from there to the upper bound
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+std::pair<typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator, typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::equalRange(const DataType& item) {
+   const Key& key = Order::key(item);
+   Node* lower = firstNotLess(head, key);
+   return std::make_pair(Iterator(this, lower), Iterator(this, firstGreater(lower, key)));
+}
+
+// Range iterator: Spans from the lower bound of lo to the upper bound of hi in one walk
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+IteratorRange<typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::rangeIterator(const DataType& lo, const DataType& hi) {
+   const Key& loKey = Order::key(lo);
+   const Key& hiKey = Order::key(hi);
+   Node* lower = firstNotLess(head, loKey);
+   Node* upper = Order::less(hiKey, loKey) ? lower : firstGreater(lower, hiKey);
+   return IteratorRange<Iterator>(Iterator(this, lower), Iterator(this, upper));
+}
+
+// First not less: Advances past every key less than key
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Node* LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::firstNotLess(Node* from, const Key& key) {
+   while (from != nullptr && Order::less(from->getKey(), key)) {
+       from = from->next;
+   }
+   return from;
+}
+
+// First greater: Advances past every key not greater than key
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Node* LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::firstGreater(Node* from, const Key& key) {
+   while (from != nullptr && !Order::less(key, from->getKey())) {
+       from = from->next;
+   }
+   return from;
+}
+
 // Make list empty: Clears the list by deleting all nodes
-template <class DataType>
-void LinkedADTList<DataType>::makeEmpty() {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::makeEmpty() {
    clear(); // Call the clear function to delete all nodes
 }
 
 // Delete an item: Removes an item from the list if it exists
-template <class DataType>
-bool LinkedADTList<DataType>::deleteItem(const DataType& item) {
-   Node *previous = nullptr; // Pointer to the previous node
-   Node *current = head; // Pointer to the current node
-   while (current != nullptr && current->value != item) { // Traverse the list
-       previous = current; // Update the previous node
-       current = current->next; // Move to the next node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::deleteItem(const DataType& item) {
+   typename StatsPolicy::Timer timer(stats, STATS_DELETE);
+   const Key& key = Order::key(item);
+   reclaim();
+   if constexpr (NodeIndex<Node>::ENABLED) {
+       if (frozen == nullptr) { // The index cannot tell whether the link lies in a shared node
+           Node** link = index.find(&head, size, key);
+           if (link == nullptr) {
+               return false;
+           }
+           Node* current = *link;
+           *link = current->next;
+           index.unlinked(link, current);
+           destroyNode(current);
+           size--;
+           return true;
+       }
+   }
+   Node** link = &head; // Link to the current node
+   Node** boundary = nullptr; // Link to the first shared node, once the walk has passed it
+   Node* previous = nullptr; // Pointer to the previous node
+   long long walked = 0;
+   while (*link != nullptr && Order::less((*link)->getKey(), key)) { // Traverse the list until the item's position
+       if (*link == frozen) {
+           boundary = link;
+       }
+       previous = *link; // Update the previous node
+       link = &previous->next; // Move to the next node
+       walked++;
    }
-   if (current == nullptr) { // If the item was not found.
+   stats.addNodesWalked(walked);
+   Node* current = *link;
+   if (current == nullptr || !Order::equal(current->getKey(), key)) { // If the item was not found.
        return false; // Indicate failure
    }
-   if (previous == nullptr) { // If the item is at the head
-       head = head->next; // Update head to skip the current node.
-   } else { // If the item is in the middle or end
-       previous->next = current->next; // Skip the current node
+   if (boundary != nullptr) {
+       link = thaw(boundary, previous); // The previous node is shared, so copy the path to it
+   }
+   *link = current->next; // Skip the current node
+   index.unlinked(link, current);
+   if (current == frozen) { // A view may still read the node, so leave it to the run that owns it
+       frozen = current->next;
+       if (frozen == nullptr) {
+           frozenRun.reset();
+       }
+   } else {
+       destroyNode(current); // Free the memory of the deleted node
    }
-   delete current; // Free the memory of the deleted node
    size--; // Decrement the size of the list
    return true; // Indicate success
 }
 
-// Check if list is full: Always returns false for a linked list
-template <class DataType>
-bool LinkedADTList<DataType>::isFull() const {
-   return false; // Linked lists are never full
+// Save: Streams every value to a snapshot in list order
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::save(const std::string& path) const {
+   Node* first = head;
+   ListSnapshot::write<DataType>(path, size, [first](auto emit) {
+       for (Node* current = first; current != nullptr; current = current->next) {
+           emit(current->value);
+       }
+   });
 }
 
-// Deep copy function: Creates a deep copy of another list
-template <class DataType>
-void LinkedADTList<DataType>::deepCopy(const LinkedADTList& other) {
-   clear(); // Clear the current list
-
-   if (other.head == nullptr) { // If the other list is empty
-       head = nullptr; // Set head to nullptr
-       size = 0; // Set size to 0
-       return;
+// Load: Builds the snapshot's items into a separate list, appending at the tail, then takes its nodes
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::load(const std::string& path) {
+   ListSnapshot::Mapping mapping(path, sizeof(DataType), SnapshotTraits<DataType>::RAW);
+   if (mapping.getCount() > INT_MAX) {
+       throw SnapshotError("Snapshot: " + path + " holds more items than a list can.");
    }
+   LinkedADTList loaded;
+   loaded.nodes.reserve(static_cast<int>(mapping.getCount())); // Let the allocator place every node in one block
+   Node** tail = &loaded.head;
+   ListSnapshot::readItems<DataType>(mapping, [&loaded, &tail](DataType&& item) {
+       *tail = loaded.createNode(std::move(item)); // Already sorted, so no walk is needed
+       tail = &(*tail)->next;
+       loaded.size++;
+   });
+   *this = std::move(loaded);
+}
 
-   head = new Node; // Create a new head node
-   Node* curr = head; // Pointer to the current node in the new list
-   Node* other_curr = other.head; // Pointer to the current node in the other list
+// Get stats: Returns the stats policy so its contents can be read or dumped
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+const StatsPolicy& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::getStats() const {
+   return stats;
+}
 
-   curr->value = other_curr->value; // Copy the value from the other list
-   curr->next = nullptr; // Set the next pointer to nullptr
-   other_curr = other_curr->next; // Move to the next node in the other list
+// Reset stats: Zeroes everything the stats policy has recorded
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::resetStats() {
+   stats.reset();
+}
 
-   while (other_curr != nullptr) { // Traverse the other list
-       curr->next = new Node; // Create a new node in the new list.
-       curr = curr->next; // Move to the new node
-       curr->value = other_curr->value; // Copy the value from the other list
-       curr->next = nullptr; // Set the next pointer to nullptr
-       other_curr = other_curr->next; // Move to the next node in the other list
+// Snapshot: Hands the nodes not yet shared to a new run, then shares the whole chain with the view
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::snapshot() {
+   static_assert(!NodeAllocator<Node>::BULK_RELEASE, "snapshot() needs an allocator that frees nodes one at a time");
+   if (head != frozen) {
+       frozenRun = std::make_shared<FrozenRun>(head, frozen, std::move(frozenRun));
+       frozen = head;
    }
+   return View(frozenRun, head, size);
+}
 
-   size = other.size; // Copy the size of the other list
+// Check if list is full: Always returns false for a linked list
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::isFull() const {
+   return false; // Linked lists are never full
+}
+
+// Deep copy function: Overwrites the nodes this list already has, then allocates or frees only the difference
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::deepCopy(const LinkedADTList& other) {
+   if (frozen != nullptr) { // Shared nodes cannot be assigned over, so reuse only the ones before them
+       Node** boundary = &head;
+       while (*boundary != frozen) {
+           boundary = &(*boundary)->next;
+       }
+       *boundary = nullptr;
+       frozen = nullptr;
+       frozenRun.reset();
+   }
+   index.invalidate();
+   Node** link = &head; // Link to the next node to overwrite or create
+   const Node* other_curr = other.head; // Pointer to the current node in the other list
+   int copied = 0;
+   try {
+       while (other_curr != nullptr && *link != nullptr) { // Reuse an existing node
+           (*link)->value = other_curr->value; // Assign over the old value instead of destroying it
+           (*link)->refreshKey();
+           link = &(*link)->next;
+           other_curr = other_curr->next;
+           copied++;
+       }
+       if (other_curr != nullptr) {
+           nodes.reserve(other.size - copied); // Let the allocator place the missing nodes in one block
+       }
+       while (other_curr != nullptr) { // Allocate only the nodes this list is short of
+           *link = createNode(other_curr->value); // Copy-construct the value directly in its node
+           link = &(*link)->next;
+           other_curr = other_curr->next;
+           copied++;
+       }
+   } catch (...) {
+       truncate(link, copied); // Keep the copied prefix, which is still sorted
+       throw;
+   }
+   truncate(link, copied); // Free any nodes left over from a longer list
+}
+
+// Truncate: Frees every node from the given link onward
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::truncate(Node** link, int kept) {
+   Node* rest = *link;
+   *link = nullptr;
+   while (rest != nullptr) {
+       Node* temp = rest;
+       rest = rest->next;
+       destroyNode(temp);
+   }
+   size = kept;
 }
 
 // Clear the list: Deletes all nodes in the list
-template <class DataType>
-void LinkedADTList<DataType>::clear() {
-   while (head != nullptr) { // Traverse the list
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::clear() {
+   if (NodeAllocator<Node>::BULK_RELEASE) { // The allocator frees whole blocks at once
+       if (!std::is_trivially_destructible<DataType>::value) {
+           for (Node* curr = head; curr != nullptr; ) { // Values still need their destructors run
+               Node* temp = curr;
+               curr = curr->next;
+               temp->~Node();
+           }
+       }
+       nodes.releaseAll();
+       head = nullptr;
+   }
+   while (head != frozen) { // Traverse the list up to the nodes shared with views
        Node* temp = head; // Store the current head node
        head = head->next; // Move head to the next node
-       delete temp; // Delete the stored node
+       destroyNode(temp); // Delete the stored node
    }
+   head = nullptr;
+   frozen = nullptr;
+   frozenRun.reset(); // The shared nodes are freed with the last view
+   index.invalidate();
    size = 0; // Reset the size to 0
 }
 
+// Create node: Allocates storage for a node and constructs its value in place
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+template <typename... Args>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Node* LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::createNode(Args&&... args) {
+   void* storage = nodes.allocate();
+   stats.addAllocations(1);
+   try {
+       Node* node = new (storage) Node{{}, nullptr, DataType(std::forward<Args>(args)...)};
+       node->refreshKey();
+       return node;
+   } catch (...) {
+       nodes.deallocate(storage); // Do not leak the storage if the value's constructor throws
+       throw;
+   }
+}
+
+// Destroy node: Runs the value's destructor and hands the storage back to the allocator
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+void LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::destroyNode(Node* node) {
+   node->~Node();
+   nodes.deallocate(node);
+}
+
 // Iterator Constructor: Initializes an iterator with a list and a node
-template <class DataType>
-LinkedADTList<DataType>::Iterator::Iterator(LinkedADTList* myList, Node* current) {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator::Iterator(LinkedADTList* myList, Node* current) {
    this->myList = myList; // Set the list pointer
    this->current = current; // Set the current node pointer
 }
 
 // Iterator Dereference Operator: Returns the value of the current node
-template <class DataType>
-DataType& LinkedADTList<DataType>::Iterator::operator*() const {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+const DataType& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator::operator*() const {
    if (current == nullptr) { // Check if the iterator is at the end
        throw std::out_of_range("Iterator is at the end of the list.");
    }
@@ -175,8 +740,8 @@ DataType& LinkedADTList<DataType>::Iterator::operator*() const {
 }
 
 // Iterator Pre-increment Operator: Moves the iterator to the next node
-template <class DataType>
-typename LinkedADTList<DataType>::Iterator& LinkedADTList<DataType>::Iterator::operator++() {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator::operator++() {
    if (current == nullptr) { // Check if the iterator is at the end
        throw std::out_of_range("Iterator is at the end of the list.");
    }
@@ -185,25 +750,138 @@ typename LinkedADTList<DataType>::Iterator& LinkedADTList<DataType>::Iterator::o
 }
 
 // Iterator Equality Comparison: Checks if two iterators are equal
-template <class DataType>
-bool LinkedADTList<DataType>::Iterator::operator==(const Iterator& other) const {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator::operator==(const Iterator& other) const {
    return (current == other.current); // Compare the current nodes
 }
 
 // Iterator Inequality Comparison: Checks if two iterators are not equal
-template <class DataType>
-bool LinkedADTList<DataType>::Iterator::operator!=(const Iterator& other) const {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator::operator!=(const Iterator& other) const {
    return !(*this == other); // Use the equality operator for comparison
 }
 
 // Begin: Returns an iterator pointing to the first node in the list
-template <class DataType>
-typename LinkedADTList<DataType>::Iterator LinkedADTList<DataType>::begin() {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::begin() {
    return Iterator(this, head); // Create and return an iterator at the head
 }
 
 // End: Returns an iterator pointing to one past the last node in the list
-template <class DataType>
-typename LinkedADTList<DataType>::Iterator LinkedADTList<DataType>::end() {
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::Iterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::end() {
    return Iterator(this, nullptr); // Create and return an iterator at the end
 }
+
+// Begin (const): Returns a read-only iterator at the first node in the list
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::ConstIterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::begin() const {
+   return ConstIterator(head);
+}
+
+// End (const): Returns a read-only iterator past the last node in the list
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::ConstIterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::end() const {
+   return ConstIterator(nullptr);
+}
+
+// Frozen run constructor: Takes over the nodes from first up to stop
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::FrozenRun::FrozenRun(Node* first, Node* stop, std::shared_ptr<FrozenRun> older)
+   : first(first), stop(stop), older(std::move(older)) {}
+
+// Frozen run destructor: Frees its own nodes, then unwinds older runs one at a time instead of recursing
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::FrozenRun::~FrozenRun() {
+   NodeAllocator<Node> nodes; // Frees one node at a time, so any instance will do
+   while (first != stop) {
+       Node* temp = first;
+       first = first->next;
+       temp->~Node();
+       nodes.deallocate(temp);
+   }
+   std::shared_ptr<FrozenRun> next = std::move(older);
+   while (next != nullptr && next.use_count() == 1) {
+       std::atomic_thread_fence(std::memory_order_acquire); // Other holders' reads happen before the free
+       std::shared_ptr<FrozenRun> after = std::move(next->older);
+       next.reset(); // Frees that run's nodes only, since its older link is gone
+       next = std::move(after);
+   }
+}
+
+// View Default Constructor: Shares nothing and holds no items
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::View() : head(nullptr), size(0) {}
+
+// View Constructor: Shares the run that holds the chain
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::View(std::shared_ptr<const FrozenRun> run, const Node* head, int size)
+   : run(std::move(run)), head(head), size(size) {}
+
+// View Get length: Returns the number of items in view
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+int LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::getLength() const {
+   return size;
+}
+
+// View Retrieve an item: Walks the shared chain until the item's position
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::getItem(const DataType& item, DataType& found_item) const {
+   const Key& key = Order::key(item);
+   const Node* current = head;
+   while (current != nullptr && Order::less(current->getKey(), key)) {
+       current = current->next;
+   }
+   if (current != nullptr && Order::equal(current->getKey(), key)) {
+       found_item = current->value;
+       return true;
+   }
+   return false; // Indicate the item was not found
+}
+
+// View Begin: Returns an iterator at the first node in view
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::begin() const {
+   return Iterator(head);
+}
+
+// View End: Returns an iterator past the last node in view
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::end() const {
+   return Iterator(nullptr);
+}
+
+// View Iterator Constructor: Starts at the given node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator::Iterator(const Node* current) : current(current) {}
+
+// View Iterator Dereference Operator: Returns the value of the current node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+const DataType& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator::operator*() const {
+   if (current == nullptr) {
+       throw std::out_of_range("Iterator is at the end of the view.");
+   }
+   return current->value;
+}
+
+// View Iterator Pre-increment Operator: Moves the iterator to the next node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+typename LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator& LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator::operator++() {
+   if (current == nullptr) {
+       throw std::out_of_range("Iterator is at the end of the view.");
+   }
+   current = current->next;
+   return *this;
+}
+
+// View Iterator Equality Comparison: Checks if two iterators are at the same node
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator::operator==(const Iterator& other) const {
+   return current == other.current;
+}
+
+// View Iterator Inequality Comparison: Checks if two iterators are at different nodes
+template <class DataType, template <class> class NodeAllocator, class StatsPolicy, template <class> class NodeIndex, class Order>
+bool LinkedADTList<DataType, NodeAllocator, StatsPolicy, NodeIndex, Order>::View::Iterator::operator!=(const Iterator& other) const {
+   return !(*this == other);
+}
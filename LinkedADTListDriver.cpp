@@ -1,6 +1,6 @@
 #include <iostream>
-#include <fstream>
 #include "LinkedADTList.h"
+#include "MappedRecordReader.h"
 #include "Customer.h"
 
 // Function declarations
@@ -26,24 +26,17 @@ int main() {
 
 // Loads customer data from a file into the provided customer list
 void loadCustomersIntoList(const std::string& filename, LinkedADTList<Customer>& customerList, int maxCustomers) {
-   std::ifstream file(filename); // Open the file for reading
+   MappedRecordReader file(filename); // Map the file for reading
 
-   if (!file) { // Check if the file was successfully opened
+   if (!file.isOpen()) { // Check if the file was successfully opened
        std::cerr << "Unable to open file!" << std::endl;
        return;
    }
 
-   std::string line;
-   std::getline(file, line);  // Skip the header line in the file
-
-   int count = 0;
-   while (std::getline(file, line) && count < maxCustomers) { // Read each line until maxCustomers is reached
-       Customer customer(line); // Create a Customer object from the line
-       customerList.putItem(customer); // Add the customer to the list
-       count++; // Increment the count of loaded customers
-   }
-
-   file.close(); // Close the file
+   std::string scratch; // Reused by every record that has to be copied out of the mapping
+   file.forEachRecord([&customerList, &scratch](std::string_view line) { // Visit each line after the header
+       customerList.putItem(MappedRecordReader::makeItem<Customer>(line, scratch)); // Move the new Customer into its node
+   }, maxCustomers);
 }
 
 // Demonstrates the functionality of LinkedADTList using integers
@@ -0,0 +1,551 @@
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ArrayADTList.h"
+#include "BTreeADTList.h"
+#include "GappedADTList.h"
+#include "LinkedADTList.h"
+#include "Customer.h"
+
+// Runs every list operation across containers, element types, sizes, and key distributions,
+// and writes the results as JSON in the layout Google Benchmark uses (--benchmark_format=json),
+// so the same tooling can diff runs across releases.
+//
+// Usage: ListBenchmark [--min_time=SECONDS] [--max_size=N] [--filter=SUBSTRING] [--out=FILE]
+
+// Receives results from the timed loops so they cannot be discarded
+volatile long long benchmarkSink = 0;
+
+// Order in which the operation under test visits keys
+enum Distribution { SORTED, REVERSE, RANDOM, ZIPF, DISTRIBUTION_COUNT };
+const char* const DISTRIBUTION_NAMES[DISTRIBUTION_COUNT] = { "sorted", "reverse", "random", "zipf" };
+
+const int MAX_PROBES = 1 << 16;         // Distinct keys each per-item benchmark cycles through
+const long long POOL_ELEMENTS = 1 << 16; // Elements held by the copies prepared for makeEmpty and copy
+
+// Settings taken from the command line
+struct Options {
+   double minTime;       // Seconds of timed work each benchmark must accumulate
+   int maxSize;          // Largest list size to run
+   std::string filter;   // Only run benchmarks whose name contains this
+   std::string outFile;  // Where to write the JSON; stdout if empty
+};
+
+// One entry in the "benchmarks" array of the report
+struct Result {
+   std::string name;
+   std::string container;
+   std::string type;
+   std::string operation;
+   std::string distribution;
+   int size;
+   long long iterations;
+   double realNs;       // Total timed wall-clock nanoseconds
+   double cpuNs;        // Total timed process CPU nanoseconds
+   long long items;     // Items processed, for items_per_second
+};
+
+// Accumulates only the regions between start and stop, so untimed setup can be excluded
+class Stopwatch {
+public:
+   Stopwatch() : realNs(0), cpuNs(0), cpuStart(0) {}
+
+   void start() {
+       cpuStart = std::clock();
+       realStart = std::chrono::steady_clock::now();
+   }
+
+   void stop() {
+       realNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - realStart).count();
+       cpuNs += static_cast<double>(std::clock() - cpuStart) * 1e9 / CLOCKS_PER_SEC;
+   }
+
+   double realNs;
+   double cpuNs;
+
+private:
+   std::chrono::steady_clock::time_point realStart;
+   std::clock_t cpuStart;
+};
+
+// Detects the bulk operations, so their benchmarks only run on containers that have them
+template <typename List, typename DataType, typename = void>
+struct HasPutItems : std::false_type {};
+template <typename List, typename DataType>
+struct HasPutItems<List, DataType, decltype(std::declval<List&>().putItems(std::declval<DataType*>(), std::declval<DataType*>()), void())>
+   : std::true_type {};
+template <typename List, typename DataType, typename = void>
+struct HasDeleteItems : std::false_type {};
+template <typename List, typename DataType>
+struct HasDeleteItems<List, DataType, decltype(std::declval<List&>().deleteItems(std::declval<DataType*>(), std::declval<DataType*>()), void())>
+   : std::true_type {};
+
+// Function prototypes
+bool parseOptions(int argc, char* argv[], Options& options);
+std::vector<int> makeProbeIndices(Distribution distribution, int size, int count, unsigned int seed);
+template <typename DataType> DataType makeValue(int key);
+template <typename DataType> long long touch(const DataType& item);
+template <typename List, typename DataType> void fillList(List& list, std::vector<DataType>& items);
+template <typename DataType, typename SearchPolicy, typename StatsPolicy> void fillList(ArrayADTList<DataType, SearchPolicy, StatsPolicy>& list, std::vector<DataType>& items);
+template <typename DataType, int LeafCapacity, int InnerFanout> void fillList(BTreeADTList<DataType, LeafCapacity, InnerFanout>& list, std::vector<DataType>& items);
+template <typename Reset, typename Body>
+void measure(double minTime, long long limit, Reset reset, Body body, Stopwatch& watch, long long& iterations);
+template <typename List, typename DataType>
+void runContainer(const char* container, const char* typeName, int size, const std::vector<std::vector<int> >& probes,
+                  const Options& options, std::vector<Result>& results);
+std::string jsonEscape(const std::string& text);
+void writeReport(std::ostream& out, const std::vector<Result>& results, const Options& options, const char* executable);
+
+int main(int argc, char* argv[]) {
+   using namespace std;
+
+   Options options;
+   if (!parseOptions(argc, argv, options)) {
+       cerr << "Usage: " << argv[0] << " [--min_time=SECONDS] [--max_size=N] [--filter=SUBSTRING] [--out=FILE]" << endl;
+       return 1;
+   }
+
+   vector<Result> results;
+   for (long long size = 10; size <= options.maxSize; size *= 10) {
+       // Key indices are shared by every container and type at this size
+       int count = static_cast<int>(min<long long>(size, MAX_PROBES));
+       vector<vector<int> > probes(DISTRIBUTION_COUNT);
+       for (int d = 0; d < DISTRIBUTION_COUNT; ++d) {
+           probes[d] = makeProbeIndices(static_cast<Distribution>(d), static_cast<int>(size), count, 12345u + d);
+       }
+
+       runContainer<ArrayADTList<int>, int>("ArrayADTList", "int", static_cast<int>(size), probes, options, results);
+       runContainer<LinkedADTList<int>, int>("LinkedADTList", "int", static_cast<int>(size), probes, options, results);
+       runContainer<GappedADTList<int>, int>("GappedADTList", "int", static_cast<int>(size), probes, options, results);
+       runContainer<BTreeADTList<int>, int>("BTreeADTList", "int", static_cast<int>(size), probes, options, results);
+       runContainer<ArrayADTList<Customer>, Customer>("ArrayADTList", "Customer", static_cast<int>(size), probes, options, results);
+       runContainer<LinkedADTList<Customer>, Customer>("LinkedADTList", "Customer", static_cast<int>(size), probes, options, results);
+       runContainer<GappedADTList<Customer>, Customer>("GappedADTList", "Customer", static_cast<int>(size), probes, options, results);
+       runContainer<BTreeADTList<Customer>, Customer>("BTreeADTList", "Customer", static_cast<int>(size), probes, options, results);
+   }
+
+   if (options.outFile.empty()) {
+       writeReport(cout, results, options, argv[0]);
+   } else {
+       ofstream out(options.outFile.c_str());
+       if (!out) {
+           cerr << "Error: Unable to open " << options.outFile << endl;
+           return 1;
+       }
+       writeReport(out, results, options, argv[0]);
+   }
+   return 0;
+}
+
+// Function implementations
+
+// Reads --name=value flags, accepting Google Benchmark's benchmark_ prefix as well
+bool parseOptions(int argc, char* argv[], Options& options) {
+   options.minTime = 0.2;
+   options.maxSize = 10000000;
+   for (int i = 1; i < argc; ++i) {
+       std::string arg = argv[i];
+       if (arg.compare(0, 12, "--benchmark_") == 0) {
+           arg = "--" + arg.substr(12);
+       }
+       std::string::size_type equals = arg.find('=');
+       if (arg.compare(0, 2, "--") != 0 || equals == std::string::npos) {
+           return false;
+       }
+       std::string name = arg.substr(2, equals - 2);
+       std::string value = arg.substr(equals + 1);
+       if (name == "min_time") {
+           options.minTime = std::atof(value.c_str());
+       } else if (name == "max_size") {
+           options.maxSize = std::atoi(value.c_str());
+       } else if (name == "filter") {
+           options.filter = value;
+       } else if (name == "out") {
+           options.outFile = value;
+       } else {
+           return false;
+       }
+   }
+   return options.minTime > 0 && options.maxSize > 0;
+}
+
+// Picks which of the size stored keys each operation visits, in the order it visits them
+std::vector<int> makeProbeIndices(Distribution distribution, int size, int count, unsigned int seed) {
+   std::vector<int> indices(count);
+   std::mt19937 generator(seed);
+   if (distribution == SORTED || distribution == REVERSE) {
+       for (int i = 0; i < count; ++i) {
+           indices[i] = static_cast<int>(static_cast<long long>(i) * size / count); // Spread evenly over the list
+       }
+       if (distribution == REVERSE) {
+           std::reverse(indices.begin(), indices.end());
+       }
+   } else if (distribution == RANDOM) {
+       if (count == size) { // Visit every key exactly once
+           for (int i = 0; i < count; ++i) {
+               indices[i] = i;
+           }
+           std::shuffle(indices.begin(), indices.end(), generator);
+       } else {
+           std::uniform_int_distribution<int> pick(0, size - 1);
+           for (int i = 0; i < count; ++i) {
+               indices[i] = pick(generator);
+           }
+       }
+   } else {
+       // Zipf with theta 0.99 over ranks, using the inversion from Gray et al. as popularised by
+       // YCSB. Ranks are then scattered over the key space so the hot keys are not all at the front.
+       const double theta = 0.99;
+       double zetaN = 0;
+       for (int i = 1; i <= size; ++i) {
+           zetaN += 1.0 / std::pow(static_cast<double>(i), theta);
+       }
+       double zeta2 = 1.0 + 1.0 / std::pow(2.0, theta);
+       double alpha = 1.0 / (1.0 - theta);
+       double eta = (1.0 - std::pow(2.0 / size, 1.0 - theta)) / (1.0 - zeta2 / zetaN);
+       std::uniform_real_distribution<double> unit(0.0, 1.0);
+       for (int i = 0; i < count; ++i) {
+           double u = unit(generator);
+           double uz = u * zetaN;
+           long long rank;
+           if (uz < 1.0) {
+               rank = 0;
+           } else if (uz < zeta2) {
+               rank = 1;
+           } else {
+               rank = static_cast<long long>(size * std::pow(eta * u - eta + 1.0, alpha));
+           }
+           rank = std::min<long long>(rank, size - 1);
+           unsigned long long scattered = static_cast<unsigned long long>(rank) * 0x9E3779B97F4A7C15ULL;
+           indices[i] = static_cast<int>((scattered >> 17) % static_cast<unsigned long long>(size));
+       }
+   }
+   return indices;
+}
+
+// Builds an int key
+template <>
+int makeValue<int>(int key) {
+   return key;
+}
+
+// Builds a Customer from a synthetic record whose zero-padded id sorts the same way as the key
+template <>
+Customer makeValue<Customer>(int key) {
+   std::string digits = std::to_string(key);
+   std::string id = std::string(10 - digits.size(), '0') + digits;
+   return Customer(id + ",First" + digits + ",Last" + digits + ",customer" + digits + "@example.com");
+}
+
+// Reads the first byte of an item so iteration has to bring it into cache
+template <typename DataType>
+long long touch(const DataType& item) {
+   return *reinterpret_cast<const unsigned char*>(&item);
+}
+
+// Fills a list with items already in sorted order; descending putItem calls insert at the head
+template <typename List, typename DataType>
+void fillList(List& list, std::vector<DataType>& items) {
+   for (typename std::vector<DataType>::reverse_iterator it = items.rbegin(); it != items.rend(); ++it) {
+       list.putItem(std::move(*it));
+   }
+}
+
+// Fills an array list with items already in sorted order in one bulk insert
+template <typename DataType, typename SearchPolicy, typename StatsPolicy>
+void fillList(ArrayADTList<DataType, SearchPolicy, StatsPolicy>& list, std::vector<DataType>& items) {
+   list.putItems(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+}
+
+// Fills a B+-tree list with items already in sorted order by bulk loading it
+template <typename DataType, int LeafCapacity, int InnerFanout>
+void fillList(BTreeADTList<DataType, LeafCapacity, InnerFanout>& list, std::vector<DataType>& items) {
+   list.putItems(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+}
+
+// Runs body in growing batches until minTime seconds of timed work have accumulated, much like
+// Google Benchmark picks an iteration count. body(offset, count) performs count operations
+// starting at offset operations since the last reset. reset runs with the clock stopped before
+// the first batch and before any batch that would take offset past limit. When untimed resets
+// dominate, as they do for tiny lists, the run ends after ten times minTime of wall-clock time.
+template <typename Reset, typename Body>
+void measure(double minTime, long long limit, Reset reset, Body body, Stopwatch& watch, long long& iterations) {
+   double targetNs = minTime * 1e9;
+   std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now()
+       + std::chrono::nanoseconds(static_cast<long long>(targetNs * 10));
+   long long offset = 0;
+   long long batch = 1;
+   iterations = 0;
+   reset();
+   while (watch.realNs < targetNs && (iterations == 0 || std::chrono::steady_clock::now() < deadline)) {
+       if (offset + batch > limit) {
+           reset();
+           offset = 0;
+       }
+       watch.start();
+       body(offset, batch);
+       watch.stop();
+       offset += batch;
+       iterations += batch;
+
+       double perOp = std::max(watch.realNs / iterations, 1.0);
+       long long wanted = static_cast<long long>((targetNs - watch.realNs) / perOp * 1.2) + 1;
+       batch = std::max(1LL, std::min(std::min(wanted, batch * 10), limit));
+   }
+}
+
+// Runs every operation on one container and element type at one size
+template <typename List, typename DataType>
+void runContainer(const char* container, const char* typeName, int size, const std::vector<std::vector<int> >& probes,
+                  const Options& options, std::vector<Result>& results) {
+   using namespace std;
+   const char* const perItemOps[] = { "putItem", "getItem", "deleteItem" };
+   const char* const wholeListOps[] = { "iterate", "copy", "makeEmpty", "putItems", "deleteItems" };
+   const int WHOLE_LIST_OPS = 5;
+   const bool supported[] = { true, true, true, HasPutItems<List, DataType>::value, HasDeleteItems<List, DataType>::value };
+
+   // Work out which benchmarks pass the filter before paying for setup
+   string prefix = string(container) + "<" + typeName + ">/";
+   string suffix = "/" + to_string(size);
+   vector<string> perItemNames;
+   vector<string> wholeListNames;
+   bool any = false;
+   for (int op = 0; op < 3; ++op) {
+       for (int d = 0; d < DISTRIBUTION_COUNT; ++d) {
+           perItemNames.push_back(prefix + perItemOps[op] + "/" + DISTRIBUTION_NAMES[d] + suffix);
+           any = any || perItemNames.back().find(options.filter) != string::npos;
+       }
+   }
+   for (int op = 0; op < WHOLE_LIST_OPS; ++op) {
+       wholeListNames.push_back(prefix + wholeListOps[op] + suffix);
+       any = any || (supported[op] && wholeListNames.back().find(options.filter) != string::npos);
+   }
+   if (!any) {
+       return;
+   }
+
+   // The list holds the even keys 0, 2, ..., 2 * (size - 1); inserts use the odd key after each
+   List master;
+   vector<DataType> stored; // The same items in order, kept for the bulk operations
+   {
+       vector<DataType> items;
+       items.reserve(size);
+       for (int i = 0; i < size; ++i) {
+           items.push_back(makeValue<DataType>(2 * i));
+       }
+       stored = items;
+       fillList(master, items);
+   }
+
+   for (int op = 0; op < 3; ++op) {
+       for (int d = 0; d < DISTRIBUTION_COUNT; ++d) {
+           const string& name = perItemNames[op * DISTRIBUTION_COUNT + d];
+           if (name.find(options.filter) == string::npos) {
+               continue;
+           }
+           cerr << name << endl;
+
+           vector<DataType> keys;
+           keys.reserve(probes[d].size());
+           for (size_t i = 0; i < probes[d].size(); ++i) {
+               keys.push_back(makeValue<DataType>(2 * probes[d][i] + (op == 0 ? 1 : 0)));
+           }
+           long long keyCount = static_cast<long long>(keys.size());
+
+           Stopwatch watch;
+           long long iterations = 0;
+           List work;
+           if (op == 0) { // Inserts into a fresh copy each time the keys run out, so the list stays near size
+               measure(options.minTime, keyCount,
+                       [&]() { work = master; },
+                       [&](long long offset, long long count) {
+                           for (long long i = offset; i < offset + count; ++i) {
+                               work.putItem(keys[i]);
+                           }
+                       }, watch, iterations);
+           } else if (op == 1) { // Lookups of stored keys never change the list
+               const List& lookup = master;
+               measure(options.minTime, LLONG_MAX,
+                       []() {},
+                       [&](long long offset, long long count) {
+                           DataType found;
+                           long long hits = 0;
+                           for (long long i = offset; i < offset + count; ++i) {
+                               hits += lookup.getItem(keys[i % keyCount], found) ? 1 : 0;
+                           }
+                           benchmarkSink = benchmarkSink + hits;
+                       }, watch, iterations);
+           } else { // Deletes from a fresh copy each time the keys run out
+               measure(options.minTime, keyCount,
+                       [&]() { work = master; },
+                       [&](long long offset, long long count) {
+                           long long hits = 0;
+                           for (long long i = offset; i < offset + count; ++i) {
+                               hits += work.deleteItem(keys[i]) ? 1 : 0;
+                           }
+                           benchmarkSink = benchmarkSink + hits;
+                       }, watch, iterations);
+           }
+           Result result = { name, container, typeName, perItemOps[op], DISTRIBUTION_NAMES[d], size,
+                             iterations, watch.realNs, watch.cpuNs, iterations };
+           results.push_back(result);
+       }
+   }
+
+   // The key order does not apply to whole-list operations, so they run once per size
+   long long poolSize = max(1LL, POOL_ELEMENTS / size);
+   for (int op = 0; op < WHOLE_LIST_OPS; ++op) {
+       const string& name = wholeListNames[op];
+       if (!supported[op] || name.find(options.filter) == string::npos) {
+           continue;
+       }
+       cerr << name << endl;
+
+       Stopwatch watch;
+       long long iterations = 0;
+       vector<List> pool;
+       if (op == 0) {
+           measure(options.minTime, LLONG_MAX,
+                   []() {},
+                   [&](long long, long long count) {
+                       long long sum = 0;
+                       for (long long i = 0; i < count; ++i) {
+                           for (typename List::Iterator it = master.begin(); it != master.end(); ++it) {
+                               sum += touch(*it);
+                           }
+                       }
+                       benchmarkSink = benchmarkSink + sum;
+                   }, watch, iterations);
+       } else if (op == 1) { // Copies are kept until the next reset so their destruction is not timed
+           measure(options.minTime, poolSize,
+                   [&]() {
+                       pool.clear();
+                       pool.reserve(poolSize);
+                   },
+                   [&](long long, long long count) {
+                       for (long long i = 0; i < count; ++i) {
+                           pool.emplace_back(master);
+                       }
+                   }, watch, iterations);
+       } else if (op == 2) { // Copies are prepared untimed, then emptied one per iteration
+           measure(options.minTime, poolSize,
+                   [&]() { pool.assign(poolSize, master); },
+                   [&](long long offset, long long count) {
+                       for (long long i = offset; i < offset + count; ++i) {
+                           pool[i].makeEmpty();
+                       }
+                   }, watch, iterations);
+       } else if (op == 3) { // Empty lists are prepared untimed, then each is loaded with every stored item in one call
+           if constexpr (HasPutItems<List, DataType>::value) {
+               measure(options.minTime, poolSize,
+                       [&]() {
+                           pool.clear();
+                           pool.resize(poolSize);
+                       },
+                       [&](long long offset, long long count) {
+                           for (long long i = offset; i < offset + count; ++i) {
+                               pool[i].putItems(stored.begin(), stored.end());
+                           }
+                       }, watch, iterations);
+           }
+       } else { // Copies are prepared untimed, then every other stored item is removed from each in one call
+           if constexpr (HasDeleteItems<List, DataType>::value) {
+               vector<DataType> victims;
+               for (int i = 0; i < size; i += 2) {
+                   victims.push_back(stored[i]);
+               }
+               measure(options.minTime, poolSize,
+                       [&]() { pool.assign(poolSize, master); },
+                       [&](long long offset, long long count) {
+                           long long removed = 0;
+                           for (long long i = offset; i < offset + count; ++i) {
+                               removed += pool[i].deleteItems(victims.begin(), victims.end());
+                           }
+                           benchmarkSink = benchmarkSink + removed;
+                       }, watch, iterations);
+           }
+       }
+       long long perIteration = op == 4 ? (size + 1) / 2 : size;
+       Result result = { name, container, typeName, wholeListOps[op], "none", size,
+                         iterations, watch.realNs, watch.cpuNs, iterations * perIteration };
+       results.push_back(result);
+   }
+}
+
+// Escapes a string for use inside a JSON string literal
+std::string jsonEscape(const std::string& text) {
+   std::string escaped;
+   for (size_t i = 0; i < text.size(); ++i) {
+       char c = text[i];
+       if (c == '"' || c == '\\') {
+           escaped += '\\';
+           escaped += c;
+       } else if (static_cast<unsigned char>(c) < 0x20) {
+           char buffer[8];
+           std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+           escaped += buffer;
+       } else {
+           escaped += c;
+       }
+   }
+   return escaped;
+}
+
+// Writes the context block and one entry per benchmark, with times per iteration in nanoseconds
+void writeReport(std::ostream& out, const std::vector<Result>& results, const Options& options, const char* executable) {
+   char date[64];
+   std::time_t now = std::time(nullptr);
+   std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+#ifdef NDEBUG
+   const char* buildType = "release";
+#else
+   const char* buildType = "debug";
+#endif
+
+   out.precision(10);
+   out << "{\n";
+   out << "  \"context\": {\n";
+   out << "    \"date\": \"" << date << "\",\n";
+   out << "    \"executable\": \"" << jsonEscape(executable) << "\",\n";
+   out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+   out << "    \"library_build_type\": \"" << buildType << "\",\n";
+   out << "    \"min_time\": " << options.minTime << ",\n";
+   out << "    \"max_size\": " << options.maxSize << "\n";
+   out << "  },\n";
+   out << "  \"benchmarks\": [";
+   for (size_t i = 0; i < results.size(); ++i) {
+       const Result& r = results[i];
+       double seconds = r.realNs / 1e9;
+       out << (i == 0 ? "\n" : ",\n");
+       out << "    {\n";
+       out << "      \"name\": \"" << jsonEscape(r.name) << "\",\n";
+       out << "      \"run_name\": \"" << jsonEscape(r.name) << "\",\n";
+       out << "      \"run_type\": \"iteration\",\n";
+       out << "      \"iterations\": " << r.iterations << ",\n";
+       out << "      \"real_time\": " << r.realNs / r.iterations << ",\n";
+       out << "      \"cpu_time\": " << r.cpuNs / r.iterations << ",\n";
+       out << "      \"time_unit\": \"ns\",\n";
+       out << "      \"items_per_second\": " << (seconds > 0 ? r.items / seconds : 0.0) << ",\n";
+       out << "      \"container\": \"" << r.container << "\",\n";
+       out << "      \"type\": \"" << r.type << "\",\n";
+       out << "      \"operation\": \"" << r.operation << "\",\n";
+       out << "      \"distribution\": \"" << r.distribution << "\",\n";
+       out << "      \"size\": " << r.size << "\n";
+       out << "    }";
+   }
+   out << "\n  ]\n";
+   out << "}\n";
+}
@@ -0,0 +1,94 @@
+#ifndef LIST_ORDERING_H
+#define LIST_ORDERING_H
+#include <functional>
+#include <type_traits>
+#include <utility>
+/**
+ * Ordering policies for ArrayADTList and LinkedADTList.
+ *
+ * A policy decides what the lists sort and search by. Every policy provides:
+ *   Key                                                  The type items are ordered by.
+ *   static key(const DataType& item)                     The item's key, by value or const reference.
+ *   static bool less(const Key& a, const Key& b)         Whether a sorts before b.
+ *   static bool equal(const Key& a, const Key& b)        Whether a and b name the same item.
+ *   static bool before(const DataType& a, const DataType& b)   less(key(a), key(b)).
+ *   NATURAL   True for NaturalOrder, whose arithmetic lists can use the vectorized search.
+ *   CACHED    True if LinkedADTList should store each item's key in its node.
+ *
+ * NaturalOrder is the default and compares whole items with operator< and operator==, exactly
+ * as the lists always have. KeyOrder compares only a key taken from each item, so a list of
+ * Customer can be sorted and searched by ID alone, and getItem can be given just the ID.
+ * CachedKeyOrder also keeps the key beside each item, so walking a linked list compares small
+ * keys without loading the items at all.
+ */
+
+/**
+ * Orders whole items with their own operator< and matches them with operator==.
+ *
+ * @param DataType The type of data stored in the list.
+ */
+template <class DataType>
+class NaturalOrder {
+public:
+    typedef DataType Key;
+    static const bool NATURAL = true;
+    static const bool CACHED = false;
+
+    static const DataType& key(const DataType& item) { return item; }
+    static bool less(const DataType& a, const DataType& b) { return a < b; }
+    static bool equal(const DataType& a, const DataType& b) { return a == b; }
+    static bool before(const DataType& a, const DataType& b) { return a < b; }
+};
+
+/**
+ * Orders items by a key extracted from each one. Two items are the same item when neither
+ * key sorts before the other.
+ *
+ * @param DataType The type of data stored in the list.
+ * @param KeyOf A default-constructible function object that returns an item's key.
+ * @param Compare A default-constructible function object that orders keys; std::less<> by default.
+ */
+template <class DataType, class KeyOf, class Compare = std::less<> >
+class KeyOrder {
+public:
+    typedef typename std::decay<decltype(std::declval<const KeyOf&>()(std::declval<const DataType&>()))>::type Key;
+    static const bool NATURAL = false;
+    static const bool CACHED = false;
+
+    static decltype(auto) key(const DataType& item) { return KeyOf()(item); }
+    static bool less(const Key& a, const Key& b) { return Compare()(a, b); }
+    static bool equal(const Key& a, const Key& b) { return !less(a, b) && !less(b, a); }
+    static bool before(const DataType& a, const DataType& b) { return less(key(a), key(b)); }
+};
+
+/**
+ * KeyOrder whose keys LinkedADTList stores in each node, next to the item, when it is created.
+ * The key must be small and trivially copyable, such as an integer ID or a fixed-width prefix
+ * that orders items on its own. Items must not be changed through an iterator afterwards,
+ * since the stored key would no longer match.
+ *
+ * @param DataType The type of data stored in the list.
+ * @param KeyOf A default-constructible function object that returns an item's key.
+ * @param Compare A default-constructible function object that orders keys; std::less<> by default.
+ */
+template <class DataType, class KeyOf, class Compare = std::less<> >
+class CachedKeyOrder : public KeyOrder<DataType, KeyOf, Compare> {
+public:
+    static_assert(std::is_trivially_copyable<typename KeyOrder<DataType, KeyOf, Compare>::Key>::value,
+                  "CachedKeyOrder needs a small, trivially copyable key");
+    static const bool CACHED = true;
+};
+
+/**
+ * Reads a key through a member function or data member pointer, for use as KeyOf:
+ *   KeyOrder<Customer, KeyFrom<&Customer::getId> >
+ *
+ * @param Member The member to read.
+ */
+template <auto Member>
+struct KeyFrom {
+    template <class DataType>
+    decltype(auto) operator()(const DataType& item) const { return std::invoke(Member, item); }
+};
+
+#endif // LIST_ORDERING_H
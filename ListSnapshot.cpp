@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ListSnapshot.h"
+
+// The non-template definitions live in a header-included file, so they are marked inline.
+
+// String write: Appends the length and then the characters
+inline void SnapshotTraits<std::string>::write(std::string& out, const std::string& item) {
+   std::uint64_t length = item.size();
+   out.append(reinterpret_cast<const char*>(&length), sizeof(length));
+   out.append(item);
+}
+
+// String read: Decodes the length and characters, refusing to run past the payload
+inline std::string SnapshotTraits<std::string>::read(const char*& cursor, const char* end) {
+   std::uint64_t length;
+   if (static_cast<std::size_t>(end - cursor) < sizeof(length)) {
+       throw SnapshotError("Snapshot: truncated string length.");
+   }
+   std::memcpy(&length, cursor, sizeof(length));
+   cursor += sizeof(length);
+   if (static_cast<std::uint64_t>(end - cursor) < length) {
+       throw SnapshotError("Snapshot: truncated string.");
+   }
+   std::string item(cursor, static_cast<std::size_t>(length));
+   cursor += length;
+   return item;
+}
+
+// Checksum: Mixes in eight bytes at a time, then the remaining tail one byte at a time
+inline std::uint64_t ListSnapshot::checksum(const char* data, std::size_t length, std::uint64_t state) {
+   const std::uint64_t prime = 1099511628211ULL;
+   std::size_t i = 0;
+   for (; i + 8 <= length; i += 8) {
+       std::uint64_t word;
+       std::memcpy(&word, data + i, 8);
+       state = (state ^ word) * prime;
+   }
+   for (; i < length; ++i) {
+       state = (state ^ static_cast<unsigned char>(data[i])) * prime;
+   }
+   return state;
+}
+
+// Mapping constructor: Maps the whole file and checks the header, size, and checksum
+inline ListSnapshot::Mapping::Mapping(const std::string& path, std::size_t elementSize, bool raw, bool verifyChecksum)
+   : address(MAP_FAILED), length(0), count(0) {
+   static_assert(sizeof(Header) == HEADER_BYTES, "Snapshot header must fill HEADER_BYTES exactly.");
+   int descriptor = ::open(path.c_str(), O_RDONLY);
+   if (descriptor < 0) {
+       throw SnapshotError("Snapshot: unable to open " + path);
+   }
+   struct stat info;
+   if (fstat(descriptor, &info) != 0 || static_cast<std::size_t>(info.st_size) < HEADER_BYTES) {
+       ::close(descriptor);
+       throw SnapshotError("Snapshot: " + path + " is too short to be a snapshot.");
+   }
+   length = static_cast<std::size_t>(info.st_size);
+   address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+   ::close(descriptor); // The mapping keeps the file contents alive
+   if (address == MAP_FAILED) {
+       throw SnapshotError("Snapshot: unable to map " + path);
+   }
+
+   Header header;
+   std::memcpy(&header, address, sizeof(header));
+   const char* problem = nullptr;
+   if (std::memcmp(header.magic, "ADTLIST", 8) != 0) {
+       problem = "is not a list snapshot";
+   } else if (header.version != VERSION) {
+       problem = "was written by another version";
+   } else if (header.byteOrder != BYTE_ORDER_MARK) {
+       problem = "was written on a machine with another byte order";
+   } else if (((header.flags & RAW_FLAG) != 0) != raw || header.elementSize != elementSize) {
+       problem = "holds a different item type";
+   } else if (header.payloadBytes != length - HEADER_BYTES || (raw && header.payloadBytes != header.count * elementSize)) {
+       problem = "is truncated";
+   } else if (verifyChecksum && checksum(payload(), payloadBytes()) != header.checksum) {
+       problem = "failed its checksum";
+   }
+   if (problem != nullptr) {
+       munmap(address, length);
+       throw SnapshotError("Snapshot: " + path + " " + problem + ".");
+   }
+   count = static_cast<long long>(header.count);
+}
+
+// Mapping destructor: Releases the mapping
+inline ListSnapshot::Mapping::~Mapping() {
+   munmap(address, length);
+}
+
+// Get count: Returns the number of items recorded in the header
+inline long long ListSnapshot::Mapping::getCount() const {
+   return count;
+}
+
+// Payload: Returns the first byte after the header
+inline const char* ListSnapshot::Mapping::payload() const {
+   return static_cast<const char*>(address) + HEADER_BYTES;
+}
+
+// Payload bytes: Returns the size of everything after the header
+inline std::size_t ListSnapshot::Mapping::payloadBytes() const {
+   return length - HEADER_BYTES;
+}
+
+// Write: Encodes each item the producer emits and streams it out in large pieces
+template <typename DataType, typename Producer>
+void ListSnapshot::write(const std::string& path, long long count, Producer produce) {
+   typedef SnapshotTraits<DataType> Traits;
+   Writer writer(path, sizeof(DataType), Traits::RAW, count);
+   long long emitted = 0;
+   produce([&writer, &emitted](const DataType& item) {
+       if constexpr (Traits::RAW) {
+           writer.buffer().append(reinterpret_cast<const char*>(&item), sizeof(DataType));
+       } else {
+           Traits::write(writer.buffer(), item);
+       }
+       if (writer.buffer().size() >= (1 << 20)) {
+           writer.flush();
+       }
+       ++emitted;
+   });
+   if (emitted != count) {
+       throw SnapshotError("Snapshot: item count changed while writing " + path);
+   }
+   writer.commit();
+}
+
+// Write block: Raw items go out in one write; other types fall back to one item at a time
+template <typename DataType>
+void ListSnapshot::writeBlock(const std::string& path, const DataType* items, long long count) {
+   if constexpr (SnapshotTraits<DataType>::RAW) {
+       Writer writer(path, sizeof(DataType), true, count);
+       writer.append(reinterpret_cast<const char*>(items), static_cast<std::size_t>(count) * sizeof(DataType));
+       writer.commit();
+   } else {
+       write<DataType>(path, count, [items, count](auto emit) {
+           for (long long i = 0; i < count; ++i) {
+               emit(items[i]);
+           }
+       });
+   }
+}
+
+// Read items: Copies raw items out of the mapping, or decodes them through the traits
+template <typename DataType, typename Visitor>
+void ListSnapshot::readItems(const Mapping& mapping, Visitor visit) {
+   typedef SnapshotTraits<DataType> Traits;
+   const char* cursor = mapping.payload();
+   const char* end = cursor + mapping.payloadBytes();
+   for (long long i = 0; i < mapping.getCount(); ++i) {
+       if constexpr (Traits::RAW) {
+           DataType item;
+           std::memcpy(static_cast<void*>(&item), cursor, sizeof(DataType));
+           cursor += sizeof(DataType);
+           visit(std::move(item));
+       } else {
+           visit(Traits::read(cursor, end));
+       }
+   }
+   if (cursor != end) {
+       throw SnapshotError("Snapshot: payload does not match its item count.");
+   }
+}
+
+// Writer constructor: Opens a temporary file beside the target and reserves room for the header
+inline ListSnapshot::Writer::Writer(const std::string& path, std::size_t elementSize, bool raw, long long count)
+   : path(path), temporaryPath(path + ".tmp"), file(nullptr), committed(false) {
+   std::memset(&header, 0, sizeof(header));
+   std::memcpy(header.magic, "ADTLIST", 8);
+   header.version = VERSION;
+   header.byteOrder = BYTE_ORDER_MARK;
+   header.flags = raw ? RAW_FLAG : 0;
+   header.elementSize = static_cast<std::uint32_t>(elementSize);
+   header.count = static_cast<std::uint64_t>(count);
+   header.checksum = CHECKSUM_SEED;
+   file = std::fopen(temporaryPath.c_str(), "wb");
+   if (file == nullptr) {
+       throw SnapshotError("Snapshot: unable to create " + temporaryPath);
+   }
+   if (std::fwrite(&header, sizeof(header), 1, file) != 1) { // The destructor will not run, so clean up here
+       std::fclose(file);
+       std::remove(temporaryPath.c_str());
+       throw SnapshotError("Snapshot: unable to write " + temporaryPath);
+   }
+}
+
+// Writer destructor: Removes the temporary file if the snapshot was never committed
+inline ListSnapshot::Writer::~Writer() {
+   if (file != nullptr) {
+       std::fclose(file);
+   }
+   if (!committed) {
+       std::remove(temporaryPath.c_str());
+   }
+}
+
+// Append: Checksums and writes bytes straight through, after anything still buffered
+inline void ListSnapshot::Writer::append(const char* data, std::size_t length) {
+   flush();
+   header.checksum = checksum(data, length, header.checksum);
+   header.payloadBytes += length;
+   if (length > 0 && std::fwrite(data, 1, length, file) != length) {
+       throw SnapshotError("Snapshot: unable to write " + temporaryPath);
+   }
+}
+
+// Buffer: Exposes the pending bytes so items can be encoded straight into them
+inline std::string& ListSnapshot::Writer::buffer() {
+   return pending;
+}
+
+// Flush: Checksums and writes the pending bytes
+inline void ListSnapshot::Writer::flush() {
+   if (pending.empty()) {
+       return;
+   }
+   std::string bytes;
+   bytes.swap(pending);
+   append(bytes.data(), bytes.size());
+   bytes.clear();
+   pending.swap(bytes); // Keep the buffer's capacity for the next items
+}
+
+// Commit: Writes the final header, closes the file, and renames it over the target
+inline void ListSnapshot::Writer::commit() {
+   flush();
+   bool written = std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, file) == 1;
+   written = std::fclose(file) == 0 && written;
+   file = nullptr;
+   if (!written || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+       throw SnapshotError("Snapshot: unable to write " + path);
+   }
+   committed = true;
+}
+
+// View constructor: Maps the snapshot; the items are used where they lie in the page cache
+template <typename DataType>
+SnapshotView<DataType>::SnapshotView(const std::string& path, bool verifyChecksum)
+   : mapping(path, sizeof(DataType), true, verifyChecksum) {
+   if (mapping.getCount() > INT_MAX) {
+       throw SnapshotError("Snapshot: " + path + " holds more items than a list can.");
+   }
+}
+
+// Get length: Returns the number of mapped items
+template <typename DataType>
+int SnapshotView<DataType>::getLength() const {
+   return static_cast<int>(mapping.getCount());
+}
+
+// Data: Returns the mapped items
+template <typename DataType>
+const DataType* SnapshotView<DataType>::data() const {
+   return reinterpret_cast<const DataType*>(mapping.payload());
+}
+
+// Index operator: Returns one mapped item, checking the index
+template <typename DataType>
+const DataType& SnapshotView<DataType>::operator[](int index) const {
+   if (index < 0 || index >= getLength()) {
+       throw std::out_of_range("SnapshotView index out of range.");
+   }
+   return data()[index];
+}
+
+// Begin: Returns a pointer to the first item
+template <typename DataType>
+const DataType* SnapshotView<DataType>::begin() const {
+   return data();
+}
+
+// End: Returns a pointer past the last item
+template <typename DataType>
+const DataType* SnapshotView<DataType>::end() const {
+   return data() + getLength();
+}
+
+// Retrieve an item: Binary searches the mapped items
+template <typename DataType>
+bool SnapshotView<DataType>::getItem(const DataType& item, DataType& foundItem) const {
+   const DataType* position = std::lower_bound(begin(), end(), item);
+   if (position != end() && *position == item) {
+       foundItem = *position;
+       return true;
+   }
+   return false;
+}
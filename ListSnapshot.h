@@ -0,0 +1,279 @@
+#ifndef LIST_SNAPSHOT_H
+#define LIST_SNAPSHOT_H
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+/**
+ * Binary snapshots of sorted list contents, used by save() and load() on the list classes.
+ *
+ * A snapshot is a 64-byte header followed by the items in sorted order. The header holds a
+ * magic string, a format version, a byte-order mark, the element size, the item count, the
+ * payload length, and a 64-bit checksum of the payload. Loading therefore never parses text
+ * or sorts; it only checks the header and checksum and copies the items back.
+ *
+ * Items whose SnapshotTraits say RAW (every trivially copyable type by default) are stored
+ * as one contiguous array, starting 64 bytes into the file, so a SnapshotView can map the
+ * file and use the items in place. Other types are written and read one at a time through
+ * a SnapshotTraits specialization; std::string is provided, and other types such as Customer
+ * need one of their own.
+ */
+
+/**
+ * Thrown when a snapshot cannot be written, read, or trusted.
+ */
+class SnapshotError : public std::runtime_error {
+public:
+    explicit SnapshotError(const std::string& message) : std::runtime_error(message) {}
+};
+
+/**
+ * How items of a type are stored in a snapshot.
+ *
+ * The default stores trivially copyable types as raw bytes. To snapshot any other type,
+ * specialize this template with RAW set to false and two static functions:
+ *   static void write(std::string& out, const DataType& item);      // Append the item's bytes.
+ *   static DataType read(const char*& cursor, const char* end);     // Decode one item and advance.
+ * read should throw SnapshotError if the item would run past end.
+ *
+ * @param DataType The type of item being stored.
+ */
+template <typename DataType>
+struct SnapshotTraits {
+    static const bool RAW = std::is_trivially_copyable<DataType>::value;
+};
+
+/**
+ * Stores strings as a 64-bit length followed by their characters.
+ */
+template <>
+struct SnapshotTraits<std::string> {
+    static const bool RAW = false;
+    static void write(std::string& out, const std::string& item);
+    static std::string read(const char*& cursor, const char* end);
+};
+
+/**
+ * Writes and maps snapshot files.
+ */
+class ListSnapshot {
+public:
+    static const std::uint32_t VERSION = 1;    // Bumped whenever the layout changes.
+    static const std::size_t HEADER_BYTES = 64; // The payload starts here, aligned for any item.
+
+    /**
+     * A read-only mapping of a snapshot file whose header and checksum have been checked.
+     */
+    class Mapping {
+    public:
+        /**
+         * Maps a snapshot and checks that it holds items of the expected kind.
+         *
+         * @param path The snapshot file.
+         * @param elementSize sizeof the item type being loaded.
+         * @param raw Whether the items are expected to be stored as raw bytes.
+         * @param verifyChecksum False to skip reading the whole payload up front.
+         * @throw SnapshotError if the file is missing, truncated, of another version or
+         *        item type, or fails its checksum.
+         */
+        Mapping(const std::string& path, std::size_t elementSize, bool raw, bool verifyChecksum = true);
+
+        /**
+         * Unmaps the file.
+         */
+        ~Mapping();
+
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+
+        /**
+         * Retrieves the number of items in the snapshot.
+         *
+         * @return The item count.
+         */
+        long long getCount() const;
+
+        /**
+         * Provides the encoded items.
+         *
+         * @return The first payload byte.
+         */
+        const char* payload() const;
+
+        /**
+         * Retrieves the length of the encoded items.
+         *
+         * @return The payload size in bytes.
+         */
+        std::size_t payloadBytes() const;
+
+    private:
+        void* address;      // Start of the mapping.
+        std::size_t length; // Bytes mapped.
+        long long count;    // Items in the payload.
+    };
+
+    /**
+     * Writes a snapshot. The file is written under a temporary name and renamed into place,
+     * so a crash never leaves a half-written snapshot at path.
+     *
+     * @param path The file to create or replace.
+     * @param count The number of items produce will emit.
+     * @param produce Called once with an emit function, which it must call with each item in order.
+     * @throw SnapshotError if the file cannot be written.
+     */
+    template <typename DataType, typename Producer>
+    static void write(const std::string& path, long long count, Producer produce);
+
+    /**
+     * Writes a snapshot of items that are already contiguous, in a single write for RAW types.
+     *
+     * @param path The file to create or replace.
+     * @param items The items in sorted order.
+     * @param count The number of items.
+     * @throw SnapshotError if the file cannot be written.
+     */
+    template <typename DataType>
+    static void writeBlock(const std::string& path, const DataType* items, long long count);
+
+    /**
+     * Decodes every item of a mapped snapshot in order.
+     *
+     * @param mapping A mapping opened for DataType.
+     * @param visit Called with each item as an rvalue.
+     * @throw SnapshotError if an item cannot be decoded.
+     */
+    template <typename DataType, typename Visitor>
+    static void readItems(const Mapping& mapping, Visitor visit);
+
+    /**
+     * Computes the checksum stored in the header: FNV-1a over 64-bit words, then the tail bytes.
+     *
+     * @param data The bytes to hash.
+     * @param length The number of bytes.
+     * @param state The running hash, for checksumming data that arrives in pieces.
+     * @return The updated hash.
+     */
+    static std::uint64_t checksum(const char* data, std::size_t length, std::uint64_t state = CHECKSUM_SEED);
+
+    static const std::uint64_t CHECKSUM_SEED = 14695981039346656037ULL; // FNV-1a offset basis.
+
+private:
+    /**
+     * The on-disk header, padded to HEADER_BYTES.
+     */
+    struct Header {
+        char magic[8];           // "ADTLIST" and a terminating zero.
+        std::uint32_t version;   // VERSION when written.
+        std::uint32_t byteOrder; // BYTE_ORDER_MARK as written by the saving machine.
+        std::uint32_t flags;     // RAW_FLAG if items are stored as raw bytes.
+        std::uint32_t elementSize;
+        std::uint64_t count;
+        std::uint64_t payloadBytes;
+        std::uint64_t checksum;
+        char reserved[HEADER_BYTES - 48];
+    };
+
+    static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static const std::uint32_t RAW_FLAG = 1;
+
+    /**
+     * Streams the payload to a temporary file and renames it into place once it is complete.
+     */
+    class Writer {
+    public:
+        Writer(const std::string& path, std::size_t elementSize, bool raw, long long count);
+        ~Writer();
+        void append(const char* data, std::size_t length);
+        std::string& buffer();
+        void flush();
+        void commit();
+
+    private:
+        std::string path;
+        std::string temporaryPath;
+        std::FILE* file;          // The temporary file being written.
+        Header header;
+        std::string pending;      // Encoded items not yet written.
+        bool committed;
+    };
+};
+
+/**
+ * A sorted, read-only list served straight from a mapped snapshot file.
+ *
+ * Nothing is copied or decoded: the items are used where the kernel's page cache holds them,
+ * so opening even a very large snapshot costs only the checksum pass, and that can be skipped.
+ *
+ * @param DataType A type whose SnapshotTraits are RAW.
+ */
+template <typename DataType>
+class SnapshotView {
+public:
+    static_assert(SnapshotTraits<DataType>::RAW, "SnapshotView needs items stored as raw bytes.");
+    static_assert(alignof(DataType) <= ListSnapshot::HEADER_BYTES, "Items must fit the payload alignment.");
+
+    /**
+     * Maps a snapshot written by save() on a list of DataType.
+     *
+     * @param path The snapshot file.
+     * @param verifyChecksum False to skip reading the whole file up front.
+     * @throw SnapshotError if the file is not a valid snapshot of DataType.
+     */
+    explicit SnapshotView(const std::string& path, bool verifyChecksum = true);
+
+    /**
+     * Retrieves the number of items.
+     *
+     * @return The item count.
+     */
+    int getLength() const;
+
+    /**
+     * Provides the items as a sorted array.
+     *
+     * @return The first item.
+     */
+    const DataType* data() const;
+
+    /**
+     * Accesses one item.
+     *
+     * @param index The position of the item.
+     * @return The item at index.
+     * @throw std::out_of_range if index is not a valid position.
+     */
+    const DataType& operator[](int index) const;
+
+    /**
+     * Provides a pointer to the first item, for range-based loops.
+     *
+     * @return The first item.
+     */
+    const DataType* begin() const;
+
+    /**
+     * Provides a pointer past the last item.
+     *
+     * @return One past the last item.
+     */
+    const DataType* end() const;
+
+    /**
+     * Looks for an item with a binary search.
+     *
+     * @param item The target item to find.
+     * @param foundItem The retrieved item if found.
+     * @return true if the item exists, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& foundItem) const;
+
+private:
+    ListSnapshot::Mapping mapping; // Keeps the file mapped for as long as the view lives.
+};
+
+#include "ListSnapshot.cpp"
+
+#endif // LIST_SNAPSHOT_H
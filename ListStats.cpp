@@ -0,0 +1,110 @@
+#include <sstream>
+#include "ListStats.h"
+
+// The non-template definitions live in a header-included file, so they are marked inline.
+
+// Inline too, so every translation unit that includes this file shares the one table
+inline const char* const STATS_OPERATION_NAMES[STATS_OPERATION_COUNT] = { "putItem", "getItem", "deleteItem", "copy" };
+
+// Timer constructor: Reads the clock
+inline CountingStats::Timer::Timer(CountingStats& stats, StatsOperation operation)
+   : stats(stats), operation(operation), start(std::chrono::steady_clock::now()) {}
+
+// Timer destructor: Records the time since construction
+inline CountingStats::Timer::~Timer() {
+   std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+   stats.record(operation, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+// Constructor: Starts every counter at zero
+inline CountingStats::CountingStats() {
+   reset();
+}
+
+// Add probes: Counts elements compared while searching
+inline void CountingStats::addProbes(long long count) {
+   probes += count;
+}
+
+// Add moves: Counts elements shifted or relocated
+inline void CountingStats::addMoves(long long count) {
+   moves += count;
+}
+
+// Add nodes walked: Counts nodes visited
+inline void CountingStats::addNodesWalked(long long count) {
+   nodesWalked += count;
+}
+
+// Add allocations: Counts buffers or nodes allocated
+inline void CountingStats::addAllocations(long long count) {
+   allocations += count;
+}
+
+// Record: Adds one call to the operation's totals and to the bucket for its latency
+inline void CountingStats::record(StatsOperation operation, long long nanoseconds) {
+   Latency& entry = latency[operation];
+   int bucket = 0;
+   while (bucket < BUCKETS - 1 && (1LL << bucket) <= nanoseconds) {
+       ++bucket;
+   }
+   entry.calls++;
+   entry.totalNs += nanoseconds;
+   entry.maxNs = nanoseconds > entry.maxNs ? nanoseconds : entry.maxNs;
+   entry.buckets[bucket]++;
+}
+
+// Reset: Zeroes every counter and bucket
+inline void CountingStats::reset() {
+   probes = 0;
+   moves = 0;
+   nodesWalked = 0;
+   allocations = 0;
+   for (int operation = 0; operation < STATS_OPERATION_COUNT; ++operation) {
+       latency[operation] = Latency();
+   }
+}
+
+// Getters: Return the running counters
+inline long long CountingStats::getProbes() const {
+   return probes;
+}
+
+inline long long CountingStats::getMoves() const {
+   return moves;
+}
+
+inline long long CountingStats::getNodesWalked() const {
+   return nodesWalked;
+}
+
+inline long long CountingStats::getAllocations() const {
+   return allocations;
+}
+
+inline long long CountingStats::getCalls(StatsOperation operation) const {
+   return latency[operation].calls;
+}
+
+// To JSON: Writes the counters, then each operation's totals and non-empty buckets
+inline std::string CountingStats::toJson() const {
+   std::ostringstream out;
+   out << "{\"counters\": {\"probes\": " << probes << ", \"moves\": " << moves
+       << ", \"nodesWalked\": " << nodesWalked << ", \"allocations\": " << allocations << "}, \"operations\": {";
+   for (int operation = 0; operation < STATS_OPERATION_COUNT; ++operation) {
+       const Latency& entry = latency[operation];
+       out << (operation > 0 ? ", " : "") << "\"" << STATS_OPERATION_NAMES[operation] << "\": {\"calls\": " << entry.calls
+           << ", \"totalNs\": " << entry.totalNs << ", \"maxNs\": " << entry.maxNs << ", \"histogram\": [";
+       bool first = true;
+       for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+           if (entry.buckets[bucket] == 0) {
+               continue;
+           }
+           out << (first ? "" : ", ") << "{\"lessThanNs\": " << (1LL << bucket) << ", \"count\": " << entry.buckets[bucket] << "}";
+           first = false;
+       }
+       out << "]}";
+   }
+   out << "}}";
+   return out.str();
+}
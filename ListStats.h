@@ -0,0 +1,166 @@
+#ifndef LIST_STATS_H
+#define LIST_STATS_H
+#include <chrono>
+#include <string>
+/**
+ * Statistics policies for ArrayADTList and LinkedADTList.
+ *
+ * A list reports its hot-path work to its policy through these calls:
+ *   void addProbes(long long count)        Elements compared while searching the array, as counted by
+ *                                          the search policy (see SearchPolicies.h).
+ *   void addMoves(long long count)         Elements shifted or relocated in the array.
+ *   void addNodesWalked(long long count)   Nodes visited while walking the linked list.
+ *   void addAllocations(long long count)   Buffers or nodes allocated.
+ *   Timer(Policy& stats, StatsOperation)   Times one public operation from construction to destruction.
+ *
+ * NoStats is the default: every call is an empty inline function and Timer is an empty object,
+ * so an uninstrumented list does no extra work. The lists hold their policy as
+ * [[no_unique_address]], so NoStats adds no size where the compiler honours it. CountingStats keeps
+ * the counters and a latency histogram per operation, and writes them out as JSON.
+ *
+ * The lists are not thread-safe, and neither are the policies.
+ */
+
+/**
+ * The list operations whose latency is recorded.
+ */
+enum StatsOperation {
+    STATS_PUT,             // putItem, emplaceItem and putItems.
+    STATS_GET,             // getItem.
+    STATS_DELETE,          // deleteItem.
+    STATS_COPY,            // The copy constructor and copy assignment.
+    STATS_OPERATION_COUNT
+};
+
+/**
+ * Records nothing and costs nothing.
+ */
+class NoStats {
+public:
+    static const bool ENABLED = false;
+
+    /**
+     * Does nothing; there is no clock to read.
+     */
+    class Timer {
+    public:
+        Timer(NoStats&, StatsOperation) {}
+    };
+
+    void addProbes(long long) {}
+    void addMoves(long long) {}
+    void addNodesWalked(long long) {}
+    void addAllocations(long long) {}
+    void reset() {}
+
+    /**
+     * Provides an empty JSON object, so callers need not check which policy is in use.
+     *
+     * @return "{}".
+     */
+    std::string toJson() const { return "{}"; }
+};
+
+/**
+ * Counts work on the hot paths and keeps a log2-bucketed latency histogram per operation.
+ */
+class CountingStats {
+public:
+    static const bool ENABLED = true;
+    static const int BUCKETS = 40; // Bucket b holds latencies below 2^b ns; the last also holds anything slower.
+
+    /**
+     * Reads the steady clock when constructed and records the elapsed time when destroyed.
+     */
+    class Timer {
+    public:
+        /**
+         * Starts timing an operation.
+         *
+         * @param stats The policy to record into.
+         * @param operation The operation being timed.
+         */
+        Timer(CountingStats& stats, StatsOperation operation);
+
+        /**
+         * Records the time since construction.
+         */
+        ~Timer();
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+    private:
+        CountingStats& stats;
+        StatsOperation operation;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /**
+     * Constructs a policy with every counter at zero.
+     */
+    CountingStats();
+
+    void addProbes(long long count);
+    void addMoves(long long count);
+    void addNodesWalked(long long count);
+    void addAllocations(long long count);
+
+    /**
+     * Adds one call of an operation to its latency histogram.
+     *
+     * @param operation The operation that ran.
+     * @param nanoseconds How long it took.
+     */
+    void record(StatsOperation operation, long long nanoseconds);
+
+    /**
+     * Sets every counter and histogram back to zero.
+     */
+    void reset();
+
+    long long getProbes() const;
+    long long getMoves() const;
+    long long getNodesWalked() const;
+    long long getAllocations() const;
+
+    /**
+     * Retrieves how many times an operation has been timed.
+     *
+     * @param operation The operation to look up.
+     * @return The number of calls recorded.
+     */
+    long long getCalls(StatsOperation operation) const;
+
+    /**
+     * Formats the counters and histograms as a JSON object:
+     *   {"counters": {"probes": n, "moves": n, "nodesWalked": n, "allocations": n},
+     *    "operations": {"putItem": {"calls": n, "totalNs": n, "maxNs": n,
+     *                               "histogram": [{"lessThanNs": 2^b, "count": n}, ...]}, ...}}
+     * Empty histogram buckets are left out.
+     *
+     * @return The JSON text.
+     */
+    std::string toJson() const;
+
+private:
+    /**
+     * Latency totals for one operation.
+     */
+    struct Latency {
+        long long calls;
+        long long totalNs;
+        long long maxNs;
+        long long buckets[BUCKETS];
+    };
+
+    long long probes;
+    long long moves;
+    long long nodesWalked;
+    long long allocations;
+    Latency latency[STATS_OPERATION_COUNT];
+};
+
+#include "ListStats.cpp"
+
+#endif // LIST_STATS_H
@@ -0,0 +1,173 @@
+#include <utility>
+#include "LockFreeADTList.h"
+
+// Constructor: Initializes an empty list
+template <class DataType>
+LockFreeADTList<DataType>::LockFreeADTList() : head(0), size(0) {}
+
+// Destructor: Frees every remaining node directly, since no other thread can be reading
+template <class DataType>
+LockFreeADTList<DataType>::~LockFreeADTList() {
+   makeEmpty();
+}
+
+// Get length: Returns the current item count
+template <class DataType>
+int LockFreeADTList<DataType>::getLength() const {
+   return size.load();
+}
+
+// Insert item to the list: Copies the item into a new node and links it in
+template <class DataType>
+void LockFreeADTList<DataType>::putItem(const DataType& item) {
+   insertNode(new Node{item, {0}});
+}
+
+// Insert item to the list: Moves the item into a new node and links it in
+template <class DataType>
+void LockFreeADTList<DataType>::putItem(DataType&& item) {
+   insertNode(new Node{std::move(item), {0}});
+}
+
+// Retrieve an item: Walks without helping unlink, skipping nodes that are marked deleted
+template <class DataType>
+bool LockFreeADTList<DataType>::getItem(const DataType& item, DataType& found_item) const {
+   EpochReclaimer::Guard guard;
+   Node* curr = address(head.load());
+   while (curr != nullptr && curr->value < item) {
+       curr = address(curr->next.load());
+   }
+   while (curr != nullptr && !(item < curr->value)) { // Check every equal value, some may be deleted
+       if (!isMarked(curr->next.load())) {
+           found_item = curr->value;
+           return true;
+       }
+       curr = address(curr->next.load());
+   }
+   return false;
+}
+
+// Make list empty: Frees every node directly; callers guarantee no concurrent access
+template <class DataType>
+void LockFreeADTList<DataType>::makeEmpty() {
+   Node* curr = address(head.exchange(0));
+   while (curr != nullptr) {
+       Node* temp = curr;
+       curr = address(curr->next.load());
+       delete temp;
+   }
+   size.store(0);
+}
+
+// Delete an item: Marks the node's next pointer to claim the deletion, then tries to unlink it
+template <class DataType>
+bool LockFreeADTList<DataType>::deleteItem(const DataType& item) {
+   EpochReclaimer::Guard guard;
+   while (true) {
+       std::atomic<std::uintptr_t>* previous;
+       Node* curr = search(item, &previous);
+       if (curr == nullptr || curr->value != item) { // If the item was not found
+           return false;
+       }
+       std::uintptr_t next = curr->next.load();
+       if (isMarked(next)) {
+           continue; // Another thread deleted it first; look again
+       }
+       if (!curr->next.compare_exchange_strong(next, next | 1)) {
+           continue; // The successor changed underneath us; look again
+       }
+       size.fetch_sub(1); // The mark is the point at which the item is gone
+       std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(curr);
+       if (previous->compare_exchange_strong(expected, next)) {
+           EpochReclaimer::retire(curr, destroyNode);
+       } else {
+           search(item, &previous); // Let the search unlink it on our behalf
+       }
+       return true;
+   }
+}
+
+// Check if list is full: Always returns false
+template <class DataType>
+bool LockFreeADTList<DataType>::isFull() const {
+   return false;
+}
+
+// For each: Visits every unmarked node in order under an epoch guard
+template <class DataType>
+template <typename Visitor>
+void LockFreeADTList<DataType>::forEach(Visitor visit) const {
+   EpochReclaimer::Guard guard;
+   for (Node* curr = address(head.load()); curr != nullptr; ) {
+       std::uintptr_t next = curr->next.load();
+       if (!isMarked(next)) {
+           const DataType& item = curr->value;
+           visit(item);
+       }
+       curr = address(next);
+   }
+}
+
+// Address: Clears the mark bit to recover the node pointer
+template <class DataType>
+typename LockFreeADTList<DataType>::Node* LockFreeADTList<DataType>::address(std::uintptr_t link) {
+   return reinterpret_cast<Node*>(link & ~static_cast<std::uintptr_t>(1));
+}
+
+// Is marked: Tests the mark bit
+template <class DataType>
+bool LockFreeADTList<DataType>::isMarked(std::uintptr_t link) {
+   return (link & 1) != 0;
+}
+
+// Destroy node: Deletes a node once the reclaimer has proven it unreachable
+template <class DataType>
+void LockFreeADTList<DataType>::destroyNode(void* node) {
+   delete static_cast<Node*>(node);
+}
+
+// Search: Walks to the first live node not less than item, unlinking marked nodes it passes
+template <class DataType>
+typename LockFreeADTList<DataType>::Node* LockFreeADTList<DataType>::search(const DataType& item, std::atomic<std::uintptr_t>** previous) {
+retry:
+   std::atomic<std::uintptr_t>* prev = &head;
+   Node* curr = address(prev->load());
+   while (curr != nullptr) {
+       std::uintptr_t next = curr->next.load();
+       if (prev->load() != reinterpret_cast<std::uintptr_t>(curr)) {
+           goto retry; // The predecessor changed or was deleted; start over
+       }
+       if (isMarked(next)) { // curr is deleted, so help unlink it
+           std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(curr);
+           if (!prev->compare_exchange_strong(expected, next & ~static_cast<std::uintptr_t>(1))) {
+               goto retry;
+           }
+           EpochReclaimer::retire(curr, destroyNode);
+       } else {
+           if (!(curr->value < item)) {
+               *previous = prev;
+               return curr;
+           }
+           prev = &curr->next;
+       }
+       curr = address(next);
+   }
+   *previous = prev;
+   return nullptr;
+}
+
+// Insert node: Points the node at its successor and swings the predecessor's link to it
+template <class DataType>
+void LockFreeADTList<DataType>::insertNode(Node* node) {
+   EpochReclaimer::Guard guard;
+   while (true) {
+       std::atomic<std::uintptr_t>* previous;
+       Node* curr = search(node->value, &previous);
+       std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(curr);
+       node->next.store(expected);
+       if (previous->compare_exchange_strong(expected, reinterpret_cast<std::uintptr_t>(node))) {
+           size.fetch_add(1);
+           return;
+       }
+   }
+}
@@ -0,0 +1,142 @@
+#ifndef LOCK_FREE_ADT_LIST_H
+#define LOCK_FREE_ADT_LIST_H
+#include <atomic>
+#include <cstdint>
+#include "EpochReclaimer.h"
+/**
+ * A lock-free sorted linked list (Harris's algorithm with Michael's improvements).
+ *
+ * Nodes keep the value-plus-next layout of LinkedADTList, with next made atomic and its
+ * low bit used as a deletion mark. putItem links a node with one compare-and-swap;
+ * deleteItem first marks the victim's next pointer, so no insert can slip in behind it,
+ * and then unlinks it. Any thread that meets a marked node while searching helps unlink it.
+ * Unlinked nodes are freed through EpochReclaimer once no thread can still be reading them.
+ *
+ * putItem, deleteItem, getItem, getLength, and forEach may be called from any number of
+ * threads at once. makeEmpty, copying, and destruction must not overlap other operations.
+ *
+ * @param DataType The type of data stored in the list.
+ */
+template <class DataType>
+class LockFreeADTList {
+private:
+    /**
+     * Node structure for storing data and the next pointer with its deletion mark.
+     */
+    struct Node {
+        DataType value;
+        std::atomic<std::uintptr_t> next; // Successor address, low bit set once this node is deleted.
+    };
+
+    std::atomic<std::uintptr_t> head; // Address of the first node; never marked.
+    std::atomic<int> size;            // Number of items, exact once all writers are done.
+
+    /**
+     * Strips the deletion mark from a link.
+     */
+    static Node* address(std::uintptr_t link);
+
+    /**
+     * Reports whether a link carries the deletion mark.
+     */
+    static bool isMarked(std::uintptr_t link);
+
+    /**
+     * Frees a node handed back by EpochReclaimer.
+     */
+    static void destroyNode(void* node);
+
+    /**
+     * Finds the first unmarked node whose value is not less than item, unlinking any marked
+     * nodes along the way. Must be called inside an EpochReclaimer::Guard.
+     *
+     * @param item The value to locate.
+     * @param previous Receives the link that points at the returned node.
+     * @return The node found, or nullptr if every value is less than item.
+     */
+    Node* search(const DataType& item, std::atomic<std::uintptr_t>** previous);
+
+    /**
+     * Links a new node into its sorted position.
+     *
+     * @param node The node to insert.
+     */
+    void insertNode(Node* node);
+
+public:
+    /**
+     * Constructs an empty list.
+     */
+    LockFreeADTList();
+
+    /**
+     * Destroys the list. No other thread may be using it.
+     */
+    ~LockFreeADTList();
+
+    LockFreeADTList(const LockFreeADTList&) = delete;
+    LockFreeADTList& operator=(const LockFreeADTList&) = delete;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The size at some moment during the call.
+     */
+    int getLength() const;
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into the new node.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Searches for an item without writing to shared memory.
+     *
+     * @param item The value to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Empties the list. No other thread may be using it.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete.
+     * @return True if this call deleted it, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Always false since nodes are dynamically allocated.
+     */
+    bool isFull() const;
+
+    /**
+     * Visits every item that is not deleted, in sorted order. Items inserted or deleted by
+     * other threads during the walk may or may not be seen.
+     *
+     * @param visit Called with a const reference to each item.
+     */
+    template <typename Visitor>
+    void forEach(Visitor visit) const;
+};
+
+#include "LockFreeADTList.cpp"
+
+#endif // LOCK_FREE_ADT_LIST_H
@@ -0,0 +1,67 @@
+#include <mutex>
+#include <utility>
+#include "LockedADTList.h"
+
+// Constructor: Initializes an empty guarded list
+template <class DataType, class List>
+LockedADTList<DataType, List>::LockedADTList() {}
+
+// Get length: Reads the size under the shared lock
+template <class DataType, class List>
+int LockedADTList<DataType, List>::getLength() const {
+   std::shared_lock<std::shared_mutex> lock(mutex);
+   return list.getLength();
+}
+
+// Insert item to the list: Copies the item in under the exclusive lock
+template <class DataType, class List>
+void LockedADTList<DataType, List>::putItem(const DataType& item) {
+   std::unique_lock<std::shared_mutex> lock(mutex);
+   list.putItem(item);
+}
+
+// Insert item to the list: Moves the item in under the exclusive lock
+template <class DataType, class List>
+void LockedADTList<DataType, List>::putItem(DataType&& item) {
+   std::unique_lock<std::shared_mutex> lock(mutex);
+   list.putItem(std::move(item));
+}
+
+// Retrieve an item: Searches under the shared lock so readers do not block each other
+template <class DataType, class List>
+bool LockedADTList<DataType, List>::getItem(const DataType& item, DataType& found_item) const {
+   std::shared_lock<std::shared_mutex> lock(mutex);
+   return list.getItem(item, found_item);
+}
+
+// Make list empty: Clears the list under the exclusive lock
+template <class DataType, class List>
+void LockedADTList<DataType, List>::makeEmpty() {
+   std::unique_lock<std::shared_mutex> lock(mutex);
+   list.makeEmpty();
+}
+
+// Delete an item: Removes the item under the exclusive lock
+template <class DataType, class List>
+bool LockedADTList<DataType, List>::deleteItem(const DataType& item) {
+   std::unique_lock<std::shared_mutex> lock(mutex);
+   return list.deleteItem(item);
+}
+
+// Check if list is full: Asks the guarded list under the shared lock
+template <class DataType, class List>
+bool LockedADTList<DataType, List>::isFull() const {
+   std::shared_lock<std::shared_mutex> lock(mutex);
+   return list.isFull();
+}
+
+// For each: Walks the guarded list under the shared lock
+template <class DataType, class List>
+template <typename Visitor>
+void LockedADTList<DataType, List>::forEach(Visitor visit) {
+   std::shared_lock<std::shared_mutex> lock(mutex);
+   for (typename List::Iterator it = list.begin(); it != list.end(); ++it) {
+       const DataType& item = *it;
+       visit(item);
+   }
+}
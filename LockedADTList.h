@@ -0,0 +1,91 @@
+#ifndef LOCKED_ADT_LIST_H
+#define LOCKED_ADT_LIST_H
+#include <shared_mutex>
+#include "LinkedADTList.h"
+/**
+ * A thread-safe ordered list that guards an ordinary list with a reader-writer lock.
+ *
+ * Lookups take the lock in shared mode, so any number of getItem calls run in parallel;
+ * putItem, deleteItem, and makeEmpty take it exclusively. Iterators cannot be handed out
+ * safely, so traversal goes through forEach, which holds the shared lock for the whole walk.
+ *
+ * @param DataType The type of data stored in the list.
+ * @param List The list being guarded; LinkedADTList by default.
+ */
+template <class DataType, class List = LinkedADTList<DataType> >
+class LockedADTList {
+private:
+    List list;                        // The guarded list.
+    mutable std::shared_mutex mutex;  // Shared for readers, exclusive for writers.
+
+public:
+    /**
+     * Constructs an empty list.
+     */
+    LockedADTList();
+
+    LockedADTList(const LockedADTList&) = delete;
+    LockedADTList& operator=(const LockedADTList&) = delete;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The current size of the list.
+     */
+    int getLength() const;
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into place.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Searches for an item in the list while other readers continue in parallel.
+     *
+     * @param item The value to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Empties the list, removing all elements.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete.
+     * @return True if deleted, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Whatever the guarded list reports.
+     */
+    bool isFull() const;
+
+    /**
+     * Visits every item in sorted order while holding the shared lock.
+     *
+     * @param visit Called with a const reference to each item; it must not modify this list.
+     */
+    template <typename Visitor>
+    void forEach(Visitor visit);
+};
+
+#include "LockedADTList.cpp"
+
+#endif // LOCKED_ADT_LIST_H
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "MappedRecordReader.h"
+
+// The non-template definitions live in a header-included file, so they are marked inline.
+
+// Constructor: Opens the file and records its size; a failure leaves the reader closed
+inline MappedRecordReader::MappedRecordReader(const std::string& filename, std::size_t windowBytes)
+   : descriptor(-1), fileSize(0), window(0), pageSize(static_cast<std::size_t>(sysconf(_SC_PAGESIZE))) {
+   std::size_t pages = (windowBytes + pageSize - 1) / pageSize;
+   window = (pages < 2 ? 2 : pages) * pageSize; // A record may start anywhere in the first page
+   descriptor = ::open(filename.c_str(), O_RDONLY);
+   struct stat info;
+   if (descriptor >= 0 && fstat(descriptor, &info) == 0) {
+       fileSize = static_cast<long long>(info.st_size);
+   } else if (descriptor >= 0) {
+       ::close(descriptor);
+       descriptor = -1;
+   }
+}
+
+// Destructor: Closes the file
+inline MappedRecordReader::~MappedRecordReader() {
+   if (descriptor >= 0) {
+       ::close(descriptor);
+   }
+}
+
+// Is open: Reports whether the file was opened
+inline bool MappedRecordReader::isOpen() const {
+   return descriptor >= 0;
+}
+
+// Get file size: Returns the size found when the file was opened
+inline long long MappedRecordReader::getFileSize() const {
+   return fileSize;
+}
+
+// Mapped window constructor: Maps the window, or throws leaving nothing to unmap
+inline MappedRecordReader::MappedWindow::MappedWindow(int descriptor, long long offset, std::size_t length)
+   : mapped(mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, static_cast<off_t>(offset))), length(length) {
+   if (mapped == MAP_FAILED) {
+       throw std::runtime_error("MappedRecordReader: unable to map file.");
+   }
+   madvise(mapped, length, MADV_SEQUENTIAL); // Let the kernel read ahead and drop pages behind us
+}
+
+// Mapped window destructor: Unmaps the window
+inline MappedRecordReader::MappedWindow::~MappedWindow() {
+   munmap(mapped, length);
+}
+
+// Data: Returns the first mapped byte
+inline const char* MappedRecordReader::MappedWindow::data() const {
+   return static_cast<const char*>(mapped);
+}
+
+// For each record: Scans the whole file
+template <typename Visitor>
+long long MappedRecordReader::forEachRecord(Visitor visit, long long maxRecords, bool skipHeader) const {
+   return scan(0, fileSize, visit, maxRecords, skipHeader);
+}
+
+// For each record in range: Scans only the records that start inside the range
+template <typename Visitor>
+long long MappedRecordReader::forEachRecordInRange(long long begin, long long end, Visitor visit, bool skipHeader) const {
+   return scan(begin, end, visit, -1, skipHeader);
+}
+
+// Scan: Maps one window at a time, starting each window at the page that holds the first record
+// not yet visited, and hands every complete record in it to the visitor. A range that starts
+// mid-file begins one byte early and discards everything up to the first newline, which leaves
+// it at the first record that starts inside the range.
+template <typename Visitor>
+long long MappedRecordReader::scan(long long begin, long long end, Visitor& visit, long long maxRecords, bool skipHeader) const {
+   if (descriptor < 0) {
+       return 0;
+   }
+   end = std::min(end, fileSize);
+   long long count = 0;
+   bool skipping = begin > 0 || skipHeader;  // Discard the header or the tail of the previous range's record
+   long long position = begin > 0 ? begin - 1 : 0; // Offset of the first byte not yet consumed
+   std::size_t length = window;
+   bool finished = begin >= end;
+   while (!finished && position < fileSize) {
+       long long mapStart = position - position % static_cast<long long>(pageSize);
+       std::size_t mapLength = static_cast<std::size_t>(std::min<long long>(length, fileSize - mapStart));
+       MappedWindow mapped(descriptor, mapStart, mapLength); // Unmapped at the end of this pass, even if the visitor throws
+
+       const char* base = mapped.data();
+       const char* cursor = base + (position - mapStart);
+       const char* last = base + mapLength;
+       bool lastWindow = mapStart + static_cast<long long>(mapLength) == fileSize;
+       while (cursor < last) {
+           if (count == maxRecords || (!skipping && mapStart + (cursor - base) >= end)) {
+               finished = true; // The next record belongs to someone else
+               break;
+           }
+           const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', last - cursor));
+           if (newline == nullptr) {
+               if (!lastWindow) {
+                   break; // The record continues past this window
+               }
+               newline = last; // The last line has no newline
+           }
+           std::string_view record(cursor, newline - cursor);
+           if (!record.empty() && record.back() == '\r') {
+               record.remove_suffix(1);
+           }
+           if (skipping) {
+               skipping = false;
+           } else if (!record.empty()) {
+               visit(record);
+               ++count;
+           }
+           cursor = newline + 1;
+       }
+
+       long long consumed = mapStart + (cursor - base);
+       if (consumed == position) {
+           length *= 2; // A single record is longer than the window, so widen it
+       }
+       position = consumed;
+   }
+   return count;
+}
+
+// Make item: Builds from the view when the type allows it, otherwise through the reused scratch string
+template <typename DataType>
+DataType MappedRecordReader::makeItem(std::string_view record, std::string& scratch) {
+   if constexpr (std::is_constructible<DataType, std::string_view>::value) {
+       return DataType(record);
+   } else {
+       scratch.assign(record.data(), record.size());
+       return DataType(scratch);
+   }
+}
@@ -0,0 +1,143 @@
+#ifndef MAPPED_RECORD_READER_H
+#define MAPPED_RECORD_READER_H
+#include <cstddef>
+#include <string>
+#include <string_view>
+/**
+ * Reads a newline-separated text file through read-only memory maps instead of a stream.
+ *
+ * Each record is handed to the caller as a std::string_view that points straight into the
+ * mapped pages, so nothing is copied and no memory is allocated per line. The file is mapped
+ * one window at a time, which keeps the address space used bounded and lets files larger than
+ * RAM stream through; a record that straddles two windows is simply picked up again at the
+ * start of the next window. Records end at '\n' (a trailing '\r' is dropped), found with memchr,
+ * which the C library implements with vector instructions.
+ *
+ * Only POSIX systems are supported.
+ */
+class MappedRecordReader {
+public:
+    static const std::size_t DEFAULT_WINDOW = 64 << 20; // Bytes mapped at a time.
+
+    /**
+     * Opens a file for reading.
+     *
+     * @param filename Path of the file.
+     * @param windowBytes How much of the file to map at once; rounded up to whole pages.
+     */
+    explicit MappedRecordReader(const std::string& filename, std::size_t windowBytes = DEFAULT_WINDOW);
+
+    /**
+     * Closes the file.
+     */
+    ~MappedRecordReader();
+
+    MappedRecordReader(const MappedRecordReader&) = delete;
+    MappedRecordReader& operator=(const MappedRecordReader&) = delete;
+
+    /**
+     * Checks whether the file was opened successfully.
+     *
+     * @return True if the file can be read.
+     */
+    bool isOpen() const;
+
+    /**
+     * Retrieves the size of the file.
+     *
+     * @return The size in bytes, or 0 if the file is not open.
+     */
+    long long getFileSize() const;
+
+    /**
+     * Calls visit once per non-empty record, in file order.
+     *
+     * @param visit Called with a std::string_view that is only valid during the call.
+     * @param maxRecords Stops after this many records; negative for no limit.
+     * @param skipHeader True to ignore the first line of the file.
+     * @return The number of records visited.
+     * @throw std::runtime_error if the file cannot be mapped.
+     */
+    template <typename Visitor>
+    long long forEachRecord(Visitor visit, long long maxRecords = -1, bool skipHeader = true) const;
+
+    /**
+     * Calls visit once per non-empty record that starts in [begin, end), in file order. A record
+     * starts at offset 0 or just after a newline, so splitting a file at arbitrary offsets and
+     * reading each piece this way visits every record exactly once. Safe to call from several
+     * threads at once.
+     *
+     * @param begin Offset of the first byte of the range.
+     * @param end Offset one past the last byte of the range.
+     * @param visit Called with a std::string_view that is only valid during the call.
+     * @param skipHeader True to ignore the first line of the file if it starts in the range.
+     * @return The number of records visited.
+     * @throw std::runtime_error if the file cannot be mapped.
+     */
+    template <typename Visitor>
+    long long forEachRecordInRange(long long begin, long long end, Visitor visit, bool skipHeader = true) const;
+
+    /**
+     * Builds an item from a record. Types constructible from std::string_view are built from
+     * the mapped bytes directly; others are built from scratch, whose buffer is reused so
+     * repeated calls stop allocating once it is long enough for the longest record.
+     *
+     * @param record The record to convert.
+     * @param scratch A string kept by the caller across calls.
+     * @return The new item.
+     */
+    template <typename DataType>
+    static DataType makeItem(std::string_view record, std::string& scratch);
+
+private:
+    int descriptor;         // File descriptor, or -1 if the file could not be opened.
+    long long fileSize;     // Size of the file in bytes.
+    std::size_t window;     // Bytes to map at a time, a multiple of the page size.
+    std::size_t pageSize;   // Alignment required for map offsets.
+
+    /**
+     * One mapped window of the file, unmapped when it goes out of scope, so a throwing visitor
+     * cannot leak it.
+     */
+    class MappedWindow {
+    public:
+        /**
+         * Maps length bytes of the file from offset, advising the kernel that they are read in order.
+         *
+         * @param descriptor The open file.
+         * @param offset Where the window starts; a multiple of the page size.
+         * @param length The number of bytes to map.
+         * @throws std::runtime_error if the file cannot be mapped.
+         */
+        MappedWindow(int descriptor, long long offset, std::size_t length);
+
+        /**
+         * Unmaps the window.
+         */
+        ~MappedWindow();
+
+        MappedWindow(const MappedWindow&) = delete;
+        MappedWindow& operator=(const MappedWindow&) = delete;
+
+        /**
+         * Retrieves the first mapped byte.
+         *
+         * @return The start of the window.
+         */
+        const char* data() const;
+
+    private:
+        void* mapped;       // Address the window is mapped at.
+        std::size_t length; // Bytes mapped.
+    };
+
+    /**
+     * Visits records starting in [begin, end), stopping early after maxRecords of them.
+     */
+    template <typename Visitor>
+    long long scan(long long begin, long long end, Visitor& visit, long long maxRecords, bool skipHeader) const;
+};
+
+#include "MappedRecordReader.cpp"
+
+#endif // MAPPED_RECORD_READER_H
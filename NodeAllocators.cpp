@@ -0,0 +1,177 @@
+#include <new>
+#include <utility>
+#include "NodeAllocators.h"
+
+// --- HeapNodeAllocator ---
+
+// Allocate: Gets storage for one node from the global heap
+template <class NodeType>
+void* HeapNodeAllocator<NodeType>::allocate() {
+   return ::operator new(sizeof(NodeType));
+}
+
+// Deallocate: Returns one node's storage to the global heap
+template <class NodeType>
+void HeapNodeAllocator<NodeType>::deallocate(void* node) {
+   ::operator delete(node);
+}
+
+// Reserve: Nothing to prepare when every node is allocated separately
+template <class NodeType>
+void HeapNodeAllocator<NodeType>::reserve(int) {}
+
+// Release all: Not supported, the list has to free its nodes individually
+template <class NodeType>
+void HeapNodeAllocator<NodeType>::releaseAll() {}
+
+// Absorb: Nothing to take over, the heap is shared by every list
+template <class NodeType>
+void HeapNodeAllocator<NodeType>::absorb(HeapNodeAllocator&) {}
+
+// --- NodePool ---
+
+// Constructor: Starts with no slabs
+template <class NodeType>
+NodePool<NodeType>::NodePool() {
+   slabs = nullptr;
+   freeList = nullptr;
+   bump = nullptr;
+   bumpEnd = nullptr;
+   nextSlabSlots = FIRST_SLAB_SLOTS;
+   reserved = 0;
+}
+
+// Destructor: Frees every slab
+template <class NodeType>
+NodePool<NodeType>::~NodePool() {
+   releaseAll();
+}
+
+// Move Constructor: Takes over the other pool's slabs
+template <class NodeType>
+NodePool<NodeType>::NodePool(NodePool&& other) noexcept {
+   slabs = other.slabs;
+   freeList = other.freeList;
+   bump = other.bump;
+   bumpEnd = other.bumpEnd;
+   nextSlabSlots = other.nextSlabSlots;
+   reserved = other.reserved;
+   other.slabs = nullptr; // Leave the other pool empty
+   other.freeList = nullptr;
+   other.bump = nullptr;
+   other.bumpEnd = nullptr;
+   other.nextSlabSlots = FIRST_SLAB_SLOTS;
+   other.reserved = 0;
+}
+
+// Move Assignment Operator: Frees this pool's slabs and takes over the other pool's
+template <class NodeType>
+NodePool<NodeType>& NodePool<NodeType>::operator=(NodePool&& other) noexcept {
+   if (this != &other) {
+       releaseAll();
+       absorb(other);
+       nextSlabSlots = other.nextSlabSlots;
+       other.nextSlabSlots = FIRST_SLAB_SLOTS;
+   }
+   return *this;
+}
+
+// Allocate: Reuses a freed slot if there is one, otherwise bumps through the newest slab
+template <class NodeType>
+void* NodePool<NodeType>::allocate() {
+   if (reserved > 0) {
+      --reserved; // Honour reserve() so the reserved nodes end up contiguous
+      return bump++;
+   }
+   if (freeList != nullptr) {
+      Slot* slot = freeList;
+      freeList = slot->nextFree;
+      return slot;
+   }
+   if (bump == bumpEnd) {
+      addSlab(nextSlabSlots);
+      if (nextSlabSlots < MAX_SLAB_SLOTS) {
+         nextSlabSlots *= 2; // Grow slabs geometrically so large lists need few of them
+      }
+   }
+   return bump++;
+}
+
+// Deallocate: Pushes the slot onto the free list
+template <class NodeType>
+void NodePool<NodeType>::deallocate(void* node) {
+   Slot* slot = static_cast<Slot*>(node);
+   slot->nextFree = freeList;
+   freeList = slot;
+}
+
+// Reserve: Starts a slab big enough for count nodes unless the current one already has room
+template <class NodeType>
+void NodePool<NodeType>::reserve(int count) {
+   if (bumpEnd - bump < count) {
+      retireBumpRegion(); // Keep the leftover slots usable
+      addSlab(count);
+   }
+   reserved = count;
+}
+
+// Release all: Frees every slab and forgets every slot
+template <class NodeType>
+void NodePool<NodeType>::releaseAll() {
+   while (slabs != nullptr) {
+      Slab* temp = slabs;
+      slabs = slabs->next;
+      ::operator delete(temp);
+   }
+   freeList = nullptr;
+   bump = nullptr;
+   bumpEnd = nullptr;
+   reserved = 0;
+}
+
+// Absorb: Splices the other pool's slabs and free slots into this pool
+template <class NodeType>
+void NodePool<NodeType>::absorb(NodePool& other) {
+   if (this == &other) {
+      return;
+   }
+   other.retireBumpRegion();
+   if (other.slabs != nullptr) {
+      Slab* last = other.slabs;
+      while (last->next != nullptr) { // Walk the slab chain, not the nodes
+         last = last->next;
+      }
+      last->next = slabs;
+      slabs = other.slabs;
+   }
+   while (other.freeList != nullptr) {
+      Slot* slot = other.freeList;
+      other.freeList = slot->nextFree;
+      deallocate(slot);
+   }
+   other.slabs = nullptr;
+   other.reserved = 0;
+}
+
+// Add slab: Allocates a slab header followed by the slots and makes it the bump region
+template <class NodeType>
+void NodePool<NodeType>::addSlab(int slots) {
+   const std::size_t header = (sizeof(Slab) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+   static_assert(alignof(Slot) <= alignof(std::max_align_t), "NodePool does not support over-aligned nodes");
+   char* memory = static_cast<char*>(::operator new(header + slots * sizeof(Slot)));
+   Slab* slab = reinterpret_cast<Slab*>(memory);
+   slab->next = slabs;
+   slabs = slab;
+   bump = reinterpret_cast<Slot*>(memory + header);
+   bumpEnd = bump + slots;
+}
+
+// Retire bump region: Hands the unused slots of the newest slab to the free list
+template <class NodeType>
+void NodePool<NodeType>::retireBumpRegion() {
+   while (bump != bumpEnd) {
+      deallocate(bump++);
+   }
+   bump = nullptr;
+   bumpEnd = nullptr;
+}
@@ -0,0 +1,177 @@
+#ifndef NODE_ALLOCATORS_H
+#define NODE_ALLOCATORS_H
+
+#include <cstddef>
+
+/**
+ * Node allocator policies for LinkedADTList.
+ *
+ * A policy is a class template instantiated with the list's node type. It hands out raw,
+ * suitably aligned storage for one node at a time; the list constructs and destroys the
+ * nodes itself. Every policy provides:
+ *   void* allocate()            Storage for one node.
+ *   void deallocate(void* p)    Returns storage obtained from allocate().
+ *   void reserve(int count)     Hint that count nodes are about to be allocated.
+ *   BULK_RELEASE                True if releaseAll() frees every node handed out.
+ *   void releaseAll()           Frees every node at once when BULK_RELEASE is true.
+ *   void absorb(Policy& other)  Takes ownership of storage handed out by another instance.
+ *
+ * @param NodeType The node type being allocated.
+ */
+
+/**
+ * Allocates every node individually with the global operator new.
+ */
+template <class NodeType>
+class HeapNodeAllocator {
+public:
+    static const bool BULK_RELEASE = false;
+
+    /**
+     * Allocates storage for one node.
+     *
+     * @return Uninitialized storage for a node.
+     */
+    void* allocate();
+
+    /**
+     * Frees storage for one node.
+     *
+     * @param node Storage previously returned by allocate().
+     */
+    void deallocate(void* node);
+
+    /**
+     * Does nothing; every node is allocated on its own.
+     *
+     * @param count The number of nodes about to be allocated.
+     */
+    void reserve(int count);
+
+    /**
+     * Does nothing; nodes cannot be released in bulk, so the caller frees them one at a time.
+     */
+    void releaseAll();
+
+    /**
+     * Does nothing; every node already belongs to the global heap.
+     *
+     * @param other The allocator whose nodes are being taken over.
+     */
+    void absorb(HeapNodeAllocator& other);
+};
+
+/**
+ * Carves nodes out of large slabs and recycles freed nodes through a free list. Each list
+ * owns its own pool, so there is no locking and nodes of one list stay close together.
+ * Emptying the list releases whole slabs instead of freeing nodes one by one.
+ */
+template <class NodeType>
+class NodePool {
+private:
+    /**
+     * A free node's storage doubles as a link in the free list.
+     */
+    union Slot {
+        Slot* nextFree;
+        alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+    };
+
+    /**
+     * Header placed at the front of every slab; the slots follow it.
+     */
+    struct Slab {
+        Slab* next;
+    };
+
+    static const int FIRST_SLAB_SLOTS = 64;
+    static const int MAX_SLAB_SLOTS = 65536;
+
+    Slab* slabs;      // Every slab owned by this pool.
+    Slot* freeList;   // Slots returned through deallocate().
+    Slot* bump;       // Next never-used slot in the newest slab.
+    Slot* bumpEnd;    // End of the newest slab.
+    int nextSlabSlots; // Size of the next slab, doubled each time up to MAX_SLAB_SLOTS.
+    int reserved;     // Allocations still promised to the bump region by reserve().
+
+    /**
+     * Allocates a new slab and makes it the bump region.
+     *
+     * @param slots The number of node slots in the slab.
+     */
+    void addSlab(int slots);
+
+    /**
+     * Moves the unused tail of the bump region onto the free list.
+     */
+    void retireBumpRegion();
+
+public:
+    static const bool BULK_RELEASE = true;
+
+    /**
+     * Constructs an empty pool; the first slab is allocated on demand.
+     */
+    NodePool();
+
+    /**
+     * Frees every slab.
+     */
+    ~NodePool();
+
+    /**
+     * Takes over another pool's slabs.
+     *
+     * @param other The pool to take over; it is left empty.
+     */
+    NodePool(NodePool&& other) noexcept;
+
+    /**
+     * Frees this pool's slabs and takes over another pool's.
+     *
+     * @param other The pool to take over; it is left empty.
+     * @return A reference to this pool.
+     */
+    NodePool& operator=(NodePool&& other) noexcept;
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * Hands out a recycled slot, or the next slot of the newest slab.
+     *
+     * @return Uninitialized storage for a node.
+     */
+    void* allocate();
+
+    /**
+     * Pushes a slot onto the free list for reuse.
+     *
+     * @param node Storage previously returned by allocate().
+     */
+    void deallocate(void* node);
+
+    /**
+     * Ensures the next count allocations come from one contiguous slab.
+     *
+     * @param count The number of nodes about to be allocated.
+     */
+    void reserve(int count);
+
+    /**
+     * Frees every slab at once.
+     */
+    void releaseAll();
+
+    /**
+     * Takes over another pool's slabs and free slots, so nodes it handed out may be
+     * deallocated through this pool.
+     *
+     * @param other The pool to take over; it is left empty.
+     */
+    void absorb(NodePool& other);
+};
+
+#include "NodeAllocators.cpp"
+
+#endif // NODE_ALLOCATORS_H
@@ -0,0 +1,118 @@
+#include "NodeIndexes.h"
+
+// --- HashNodeIndex ---
+
+template <class NodeType>
+NodeType* HashNodeIndex<NodeType>::erasedNode = nullptr;
+
+// Constructor: Starts stale, so the first lookup builds the table
+template <class NodeType>
+HashNodeIndex<NodeType>::HashNodeIndex() {
+   used = 0;
+   shift = 64;
+   stale = true;
+}
+
+// Mix: Multiplies by 2^64 divided by the golden ratio, so the top bits depend on every input bit
+template <class NodeType>
+std::uint64_t HashNodeIndex<NodeType>::mix(const Key& key) {
+   return static_cast<std::uint64_t>(std::hash<Key>()(key)) * 0x9E3779B97F4A7C15ULL;
+}
+
+// Place: Probes linearly from the hash's home slot to the first empty or erased one
+template <class NodeType>
+void HashNodeIndex<NodeType>::place(std::uint64_t hash, NodeType** link) const {
+   std::size_t mask = slots.size() - 1;
+   std::size_t at = static_cast<std::size_t>(hash >> shift);
+   while (slots[at].link != nullptr && slots[at].link != &erasedNode) {
+       at = (at + 1) & mask;
+   }
+   used += slots[at].link == nullptr ? 1 : 0;
+   slots[at] = Slot{hash, link};
+}
+
+// Slot of: Probes from the hash's home slot until it meets the link or an empty slot
+template <class NodeType>
+typename HashNodeIndex<NodeType>::Slot* HashNodeIndex<NodeType>::slotOf(std::uint64_t hash, NodeType** link) {
+   std::size_t mask = slots.size() - 1;
+   for (std::size_t at = static_cast<std::size_t>(hash >> shift); slots[at].link != nullptr; at = (at + 1) & mask) {
+       if (slots[at].link == link) {
+           return &slots[at];
+       }
+   }
+   return nullptr;
+}
+
+// Rebuild: Sizes the table for the list, then walks it once storing every link
+template <class NodeType>
+void HashNodeIndex<NodeType>::rebuild(NodeType** head, int size) const {
+   int bits = 4;
+   while ((std::size_t(1) << bits) < static_cast<std::size_t>(size) * 4) {
+       ++bits;
+   }
+   slots.assign(std::size_t(1) << bits, Slot{0, nullptr});
+   shift = 64 - bits;
+   used = 0;
+   for (NodeType** link = head; *link != nullptr; link = &(*link)->next) {
+       place(mix((*link)->getKey()), link);
+   }
+   stale = false;
+}
+
+// Find: Compares full hashes first, so only likely matches have their keys compared
+template <class NodeType>
+NodeType** HashNodeIndex<NodeType>::find(NodeType** head, int size, const Key& key) const {
+   if (stale) {
+       rebuild(head, size);
+   }
+   std::uint64_t hash = mix(key);
+   std::size_t mask = slots.size() - 1;
+   for (std::size_t at = static_cast<std::size_t>(hash >> shift); slots[at].link != nullptr; at = (at + 1) & mask) {
+       const Slot& slot = slots[at];
+       if (slot.hash == hash && slot.link != &erasedNode && Order::equal((*slot.link)->getKey(), key)) {
+           return slot.link;
+       }
+   }
+   return nullptr;
+}
+
+// Linked: Repoints the successor's entry before adding the new node's, since both start out at link
+template <class NodeType>
+void HashNodeIndex<NodeType>::linked(NodeType** link) {
+   if (stale || static_cast<std::size_t>(used + 1) * 2 > slots.size()) {
+       stale = true;
+       return;
+   }
+   NodeType* node = *link;
+   if (node->next != nullptr) {
+       Slot* successor = slotOf(mix(node->next->getKey()), link);
+       if (successor != nullptr) {
+           successor->link = &node->next;
+       }
+   }
+   place(mix(node->getKey()), link);
+}
+
+// Unlinked: Erases the node's entry, then hangs the successor's entry from the node's old link
+template <class NodeType>
+void HashNodeIndex<NodeType>::unlinked(NodeType** link, NodeType* node) {
+   if (stale) {
+       return;
+   }
+   Slot* removed = slotOf(mix(node->getKey()), link);
+   if (removed != nullptr) {
+       removed->link = &erasedNode;
+   }
+   if (node->next != nullptr) {
+       Slot* successor = slotOf(mix(node->next->getKey()), &node->next);
+       if (successor != nullptr) {
+           successor->link = link;
+       }
+   }
+}
+
+// Invalidate: Leaves the table for the next lookup to rebuild
+template <class NodeType>
+void HashNodeIndex<NodeType>::invalidate() {
+   stale = true;
+}
@@ -0,0 +1,149 @@
+#ifndef NODE_INDEXES_H
+#define NODE_INDEXES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Node index policies for LinkedADTList.
+ *
+ * A policy is a class template instantiated with the list's node type, which has a value, a
+ * next pointer, getKey() and the list's ordering policy as OrderPolicy. It maps keys to the
+ * link that points at their node (the list's head, or the next pointer of the node before),
+ * which is what deleteItem needs to unlink a node without walking to it. Every policy provides:
+ *   ENABLED                                       True if find() can answer lookups.
+ *   Node** find(Node** head, int size, const Key& key) const
+ *                                                 The link to a node with that key, or nullptr.
+ *   void linked(Node** link)                      A node was just linked in at *link.
+ *   void unlinked(Node** link, Node* node)        node was just unlinked from link.
+ *   void invalidate()                             The list changed in any other way, or moved.
+ *
+ * @param NodeType The node type being indexed.
+ */
+
+/**
+ * Keeps no index; the list walks to every item. This is the default.
+ */
+template <class NodeType>
+class NoNodeIndex {
+public:
+    static const bool ENABLED = false;
+
+    template <typename Key>
+    NodeType** find(NodeType**, int, const Key&) const { return nullptr; }
+    void linked(NodeType**) {}
+    void unlinked(NodeType**, NodeType*) {}
+    void invalidate() {}
+};
+
+/**
+ * Keeps an open-addressing hash table from every item to the link that points at its node, so
+ * getItem and deleteItem find an item in O(1) expected time instead of walking the list. The
+ * list keeps its sorted order, so iteration and inserts are unchanged, apart from inserts
+ * patching the table. Bulk changes drop the table, and it is rebuilt by one walk on the next
+ * lookup, so bulk loads pay for hashing only once.
+ *
+ * Keys are hashed with std::hash, which must be specialized for types such as Customer unless
+ * the list is ordered by a key such as an integer ID, and equal keys must have equal hashes.
+ * Because the rebuild happens inside const lookups, a list using this index must not be
+ * searched from several threads at once without external synchronization.
+ */
+template <class NodeType>
+class HashNodeIndex {
+private:
+    typedef typename NodeType::OrderPolicy Order;
+    typedef typename Order::Key Key;
+
+    /**
+     * One table entry: the link to an item's node, and the hash of its key.
+     */
+    struct Slot {
+        std::uint64_t hash;
+        NodeType** link;   // nullptr if the slot has never been used since the last rebuild.
+    };
+
+    static NodeType* erasedNode;        // Its address marks a slot whose node was unlinked.
+
+    mutable std::vector<Slot> slots; // A power of two in size, never more than half used.
+    mutable int used;                // Slots that are not empty.
+    mutable int shift;               // 64 minus log2 of the table size.
+    mutable bool stale;              // True when the table no longer matches the list.
+
+    /**
+     * Hashes a key and spreads the bits with a Fibonacci multiply.
+     *
+     * @param key The key to hash.
+     * @return The mixed hash.
+     */
+    static std::uint64_t mix(const Key& key);
+
+    /**
+     * Puts a link in the first free slot of its probe sequence.
+     *
+     * @param hash The mixed hash of the key of the node the link points at.
+     * @param link The link to store.
+     */
+    void place(std::uint64_t hash, NodeType** link) const;
+
+    /**
+     * Finds the slot holding a given link.
+     *
+     * @param hash The mixed hash of the key of the node the link points at.
+     * @param link The link to look for.
+     * @return The slot, or nullptr if the link is not in the table.
+     */
+    Slot* slotOf(std::uint64_t hash, NodeType** link);
+
+    /**
+     * Refills the table by walking the list, sized so it is at most a quarter full.
+     *
+     * @param head The list's head link.
+     * @param size The number of nodes in the list.
+     */
+    void rebuild(NodeType** head, int size) const;
+
+public:
+    static const bool ENABLED = true;
+
+    /**
+     * Constructs an index that will be built on the first lookup.
+     */
+    HashNodeIndex();
+
+    /**
+     * Looks an item up, rebuilding the table first if the list has changed.
+     *
+     * @param head The list's head link.
+     * @param size The number of nodes in the list.
+     * @param key The key to find.
+     * @return The link to a node with an equal key, or nullptr if there is none.
+     */
+    NodeType** find(NodeType** head, int size, const Key& key) const;
+
+    /**
+     * Adds the new node, and moves its successor's entry to the new node's next pointer,
+     * unless the table is stale or would pass half full, in which case it is left to be rebuilt.
+     *
+     * @param link The link that now points at the new node.
+     */
+    void linked(NodeType** link);
+
+    /**
+     * Removes the node's entry and moves its successor's entry to the link it now hangs from.
+     *
+     * @param link The link that pointed at node and now points at its successor.
+     * @param node The unlinked node, whose value and next pointer must still be readable.
+     */
+    void unlinked(NodeType** link, NodeType* node);
+
+    /**
+     * Marks the table as out of date so the next lookup rebuilds it.
+     */
+    void invalidate();
+};
+
+#include "NodeIndexes.cpp"
+
+#endif // NODE_INDEXES_H
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "LinkedADTList.h"
+
+// Receives results from the timed loops so they cannot be discarded
+volatile long long benchmarkSink = 0;
+
+// Function prototypes
+double elapsedMs(std::chrono::steady_clock::time_point start);
+template <template <class> class NodeAllocator, typename DataType>
+void benchmarkAllocator(const char* label, const char* typeName, int count, DataType (*makeValue)(int));
+int makeInt(int i);
+std::string makeString(int i);
+
+int main() {
+   using namespace std;
+
+   // Items are inserted in descending order so every putItem links at the head, which leaves
+   // node allocation as the dominant cost instead of the sorted walk.
+   const int count = 1000000;
+   cout << "LinkedADTList node allocation, " << count << " items (ms):" << endl;
+   cout << "allocator\ttype\tputItem\tcopy\tdeleteItem\tmakeEmpty" << endl;
+   benchmarkAllocator<HeapNodeAllocator>("heap", "int", count, makeInt);
+   benchmarkAllocator<NodePool>("pool", "int", count, makeInt);
+   benchmarkAllocator<HeapNodeAllocator>("heap", "string", count, makeString);
+   benchmarkAllocator<NodePool>("pool", "string", count, makeString);
+
+   return 0;
+}
+
+// Function implementations
+
+// Returns the milliseconds elapsed since start
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+   return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Times inserts, a deep copy, deletes from the front, and makeEmpty for one allocator
+template <template <class> class NodeAllocator, typename DataType>
+void benchmarkAllocator(const char* label, const char* typeName, int count, DataType (*makeValue)(int)) {
+   LinkedADTList<DataType, NodeAllocator> list;
+
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   for (int i = count; i > 0; --i) {
+       list.putItem(makeValue(i));
+   }
+   double putMs = elapsedMs(start);
+
+   start = std::chrono::steady_clock::now();
+   LinkedADTList<DataType, NodeAllocator> copy(list);
+   double copyMs = elapsedMs(start);
+
+   start = std::chrono::steady_clock::now();
+   for (int i = 1; i <= count / 2; ++i) {
+       list.deleteItem(makeValue(i)); // Each item is at the head by the time it is deleted
+   }
+   double deleteMs = elapsedMs(start);
+
+   start = std::chrono::steady_clock::now();
+   copy.makeEmpty();
+   double emptyMs = elapsedMs(start);
+
+   benchmarkSink = benchmarkSink + list.getLength() + copy.getLength();
+   std::cout << label << "\t" << typeName
+             << "\t" << putMs << "\t" << copyMs << "\t" << deleteMs << "\t" << emptyMs << std::endl;
+}
+
+// Builds an int key
+int makeInt(int i) {
+   return i;
+}
+
+// Builds a zero-padded string key so string order matches numeric order
+std::string makeString(int i) {
+   std::string digits = std::to_string(i);
+   return std::string(12 - digits.size(), '0') + digits;
+}
@@ -0,0 +1,149 @@
+#ifndef ORDERED_LIST_H
+#define ORDERED_LIST_H
+#include <type_traits>
+#include <utility>
+#include "ArrayADTList.h"
+#include "BTreeADTList.h"
+#include "GappedADTList.h"
+#include "LinkedADTList.h"
+/**
+ * The interface every sorted list shares, and a way to choose a list at compile time.
+ *
+ * An ordered list of DataType provides, with these exact meanings:
+ *   void putItem(const DataType&), putItem(DataType&&)    Insert, after any equal items.
+ *   bool getItem(const DataType& item, DataType& found)  Copy the item equal to item into found.
+ *   bool deleteItem(const DataType&)                     Remove one equal item.
+ *   void makeEmpty()                                     Remove every item.
+ *   int getLength() const, bool isFull() const
+ *   begin() const, end() const                           Read-only, in sorted order; *it gives a const DataType&.
+ * and is default constructible and copyable. IsOrderedList checks all of this, and so does the
+ * OrderedListType concept when compiling as C++20. Code written against the contract calls the
+ * list directly, so there is no virtual dispatch; switching lists is a change of type.
+ *
+ * OrderedList<DataType, Backend> names the list a backend picks:
+ *   ArrayBackend     ArrayADTList: fastest lookups and iteration, O(n) inserts and deletes.
+ *   LinkedBackend    LinkedADTList: O(n) walks, but splicing, node allocators and stable nodes.
+ *   GappedBackend    GappedADTList: amortized O(log^2 n) updates in one gapped buffer.
+ *   BTreeBackend     BTreeADTList: O(log n) everything, sequential iteration over linked leaves.
+ *   AutoBackend<ExpectedSize, WritePercent>
+ *                    ArrayADTList or BTreeADTList, whichever ListBenchmark favours for that
+ *                    workload; see AutoBackend.
+ * A/B testing a storage strategy is then a one-line change to a typedef such as
+ *   typedef OrderedList<Customer, AutoBackend<1000000, 5> > CustomerList;
+ * Every name it resolves to is checked against the contract when it is formed.
+ */
+
+/**
+ * True if List provides the ordered-list interface for DataType.
+ *
+ * @param List The list type to check.
+ * @param DataType The type of data stored in the list.
+ */
+template <class List, class DataType, class = void>
+struct IsOrderedList : std::false_type {};
+
+template <class List, class DataType>
+struct IsOrderedList<List, DataType, std::void_t<
+    decltype(std::declval<List&>().putItem(std::declval<const DataType&>())),
+    decltype(std::declval<List&>().putItem(std::declval<DataType&&>())),
+    decltype(std::declval<List&>().makeEmpty()),
+    decltype(++std::declval<decltype(std::declval<const List&>().begin())&>())> >
+    : std::integral_constant<bool,
+        std::is_default_constructible<List>::value &&
+        std::is_copy_constructible<List>::value &&
+        std::is_copy_assignable<List>::value &&
+        std::is_same<decltype(std::declval<const List&>().getItem(std::declval<const DataType&>(), std::declval<DataType&>())), bool>::value &&
+        std::is_same<decltype(std::declval<List&>().deleteItem(std::declval<const DataType&>())), bool>::value &&
+        std::is_same<decltype(std::declval<const List&>().getLength()), int>::value &&
+        std::is_same<decltype(std::declval<const List&>().isFull()), bool>::value &&
+        std::is_same<decltype(std::declval<const List&>().begin()), decltype(std::declval<const List&>().end())>::value &&
+        std::is_same<decltype(*std::declval<const List&>().begin()), const DataType&>::value &&
+        std::is_convertible<decltype(std::declval<const List&>().begin() != std::declval<const List&>().end()), bool>::value> {};
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+/**
+ * The ordered-list contract as a C++20 concept, for constraining templates:
+ *   template <OrderedListType<Customer> List> void load(List& list);
+ */
+template <class List, class DataType>
+concept OrderedListType = IsOrderedList<List, DataType>::value;
+#endif
+
+/**
+ * Selects ArrayADTList with its default search policy.
+ */
+struct ArrayBackend {
+    template <class DataType>
+    using List = ArrayADTList<DataType>;
+};
+
+/**
+ * Selects LinkedADTList with its default allocator.
+ */
+struct LinkedBackend {
+    template <class DataType>
+    using List = LinkedADTList<DataType>;
+};
+
+/**
+ * Selects GappedADTList.
+ */
+struct GappedBackend {
+    template <class DataType>
+    using List = GappedADTList<DataType>;
+};
+
+/**
+ * Selects BTreeADTList with its default node sizes.
+ */
+struct BTreeBackend {
+    template <class DataType>
+    using List = BTreeADTList<DataType>;
+};
+
+/**
+ * Picks a list from the expected number of items and the share of operations that change it.
+ *
+ * On ListBenchmark at a million ints, a lookup in ArrayADTList is about 60 ns faster than in
+ * BTreeADTList, and an insert or delete costs about 82 us because it shifts half the array.
+ * Spread over the whole 4 MB array, that is about 0.02 ns per byte of items per write. The
+ * array is the better choice while the expected shifting per operation stays below what it
+ * saves on reads:
+ *   0.02 * ExpectedSize * sizeof(DataType) * WritePercent / 100 <= 60
+ * which is ExpectedSize * WritePercent * sizeof(DataType) <= 60 * 100 / 0.02 = 300000. To
+ * re-tune, rerun ListBenchmark and substitute its read gap and per-byte write cost. Small
+ * lists and read-mostly lists get the array; large lists with steady writes get the B+-tree.
+ * The linked and gapped lists never win on those measurements, so they are only used when
+ * named.
+ *
+ * @param ExpectedSize The number of items the list usually holds.
+ * @param WritePercent The percentage of operations that are putItem or deleteItem, 0 to 100.
+ */
+template <long long ExpectedSize = 1000, int WritePercent = 10>
+struct AutoBackend {
+    static_assert(ExpectedSize >= 0, "AutoBackend needs a non-negative ExpectedSize");
+    static_assert(WritePercent >= 0 && WritePercent <= 100, "AutoBackend needs WritePercent between 0 and 100");
+
+    template <class DataType>
+    static constexpr bool PREFERS_ARRAY = ExpectedSize * WritePercent * static_cast<long long>(sizeof(DataType)) <= 300000;
+
+    template <class DataType>
+    using List = typename std::conditional<PREFERS_ARRAY<DataType>, ArrayADTList<DataType>, BTreeADTList<DataType> >::type;
+};
+
+/**
+ * Resolves a backend's list for DataType and checks it against the contract.
+ */
+template <class DataType, class Backend>
+struct OrderedListOf {
+    typedef typename Backend::template List<DataType> type;
+    static_assert(IsOrderedList<type, DataType>::value, "The backend's list does not provide the ordered-list interface");
+};
+
+/**
+ * The sorted list of DataType that Backend selects; AutoBackend<> if none is given.
+ */
+template <class DataType, class Backend = AutoBackend<> >
+using OrderedList = typename OrderedListOf<DataType, Backend>::type;
+
+#endif // ORDERED_LIST_H
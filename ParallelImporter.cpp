@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "ParallelImporter.h"
+
+// Constructor: Picks one thread per hardware thread when no count is given
+template <class DataType>
+ParallelImporter<DataType>::ParallelImporter(int threadCount, long long chunkBytes)
+   : threads(threadCount), chunkBytes(chunkBytes > 0 ? chunkBytes : DEFAULT_CHUNK_BYTES) {
+   if (threads <= 0) {
+       threads = static_cast<int>(std::thread::hardware_concurrency());
+       threads = threads > 0 ? threads : 1;
+   }
+}
+
+// Get thread count: Returns the number of workers
+template <class DataType>
+int ParallelImporter<DataType>::getThreadCount() const {
+   return threads;
+}
+
+// Get chunk bytes: Returns the target chunk size
+template <class DataType>
+long long ParallelImporter<DataType>::getChunkBytes() const {
+   return chunkBytes;
+}
+
+// Import into: Splits, parses and sorts in parallel, merges, then adds the result to the list
+template <class DataType>
+template <class List>
+typename ParallelImporter<DataType>::Timings ParallelImporter<DataType>::importInto(const std::string& filename, List& list, bool skipHeader) const {
+   typedef std::chrono::steady_clock Clock;
+   Timings timings = Timings();
+   Clock::time_point start = Clock::now();
+
+   MappedRecordReader reader(filename);
+   if (!reader.isOpen()) {
+       throw std::runtime_error("ParallelImporter: unable to open " + filename);
+   }
+   std::vector<long long> bounds; // Offsets only; each chunk finds its own first record
+   for (long long offset = 0; offset < reader.getFileSize(); offset += chunkBytes) {
+       bounds.push_back(offset);
+   }
+   bounds.push_back(reader.getFileSize());
+   timings.chunks = static_cast<int>(bounds.size()) - 1;
+   timings.threads = std::max(1, std::min(threads, timings.chunks));
+   Clock::time_point split = Clock::now();
+   timings.splitMs = std::chrono::duration<double, std::milli>(split - start).count();
+
+   std::vector<std::vector<DataType> > runs(timings.chunks);
+   buildRuns(reader, bounds, skipHeader, runs, timings);
+   Clock::time_point built = Clock::now();
+   timings.workersMs = std::chrono::duration<double, std::milli>(built - split).count();
+
+   std::vector<DataType> merged;
+   mergeRuns(runs, merged);
+   Clock::time_point mergedAt = Clock::now();
+   timings.mergeMs = std::chrono::duration<double, std::milli>(mergedAt - built).count();
+
+   list.putItems(std::make_move_iterator(merged.begin()), std::make_move_iterator(merged.end()));
+   Clock::time_point end = Clock::now();
+   timings.insertMs = std::chrono::duration<double, std::milli>(end - mergedAt).count();
+   timings.totalMs = std::chrono::duration<double, std::milli>(end - start).count();
+   timings.records = static_cast<long long>(merged.size());
+   return timings;
+}
+
+// Build runs: Each worker repeatedly claims the next chunk, parses it, and sorts it
+template <class DataType>
+void ParallelImporter<DataType>::buildRuns(const MappedRecordReader& reader, const std::vector<long long>& bounds, bool skipHeader,
+                                           std::vector<std::vector<DataType> >& runs, Timings& timings) const {
+   typedef std::chrono::steady_clock Clock;
+   std::atomic<int> nextChunk(0);
+   std::vector<double> parseMs(timings.threads, 0.0);
+   std::vector<double> sortMs(timings.threads, 0.0);
+   std::vector<std::exception_ptr> errors(timings.threads);
+
+   std::function<void(int)> work = [&](int worker) {
+       try {
+           std::string scratch; // One per worker, reused for every record it copies
+           for (int chunk = nextChunk.fetch_add(1); chunk < static_cast<int>(runs.size()); chunk = nextChunk.fetch_add(1)) {
+               std::vector<DataType>& run = runs[chunk];
+               Clock::time_point start = Clock::now();
+               reader.forEachRecordInRange(bounds[chunk], bounds[chunk + 1], [&run, &scratch](std::string_view record) {
+                   run.push_back(MappedRecordReader::makeItem<DataType>(record, scratch));
+               }, skipHeader);
+               Clock::time_point parsed = Clock::now();
+               std::stable_sort(run.begin(), run.end()); // Stable so equal keys keep their file order
+               parseMs[worker] += std::chrono::duration<double, std::milli>(parsed - start).count();
+               sortMs[worker] += std::chrono::duration<double, std::milli>(Clock::now() - parsed).count();
+           }
+       } catch (...) {
+           errors[worker] = std::current_exception();
+           nextChunk.store(static_cast<int>(runs.size())); // Stop the other workers early
+       }
+   };
+
+   std::vector<std::thread> pool;
+   for (int worker = 1; worker < timings.threads; ++worker) {
+       pool.push_back(std::thread(work, worker));
+   }
+   work(0); // The calling thread does its share
+   for (size_t i = 0; i < pool.size(); ++i) {
+       pool[i].join();
+   }
+
+   for (int worker = 0; worker < timings.threads; ++worker) {
+       if (errors[worker]) {
+           std::rethrow_exception(errors[worker]);
+       }
+       timings.parseMs += parseMs[worker];
+       timings.sortMs += sortMs[worker];
+   }
+}
+
+// Merge runs: Repeatedly takes the smallest head among the runs using a min-heap of run indices
+template <class DataType>
+void ParallelImporter<DataType>::mergeRuns(std::vector<std::vector<DataType> >& runs, std::vector<DataType>& merged) {
+   size_t total = 0;
+   for (size_t i = 0; i < runs.size(); ++i) {
+       total += runs[i].size();
+   }
+   merged.clear();
+   merged.reserve(total);
+   if (runs.size() == 1) {
+       merged.swap(runs[0]);
+       return;
+   }
+
+   std::vector<size_t> positions(runs.size(), 0);
+   // Orders run indices so the top of the heap is the run with the smallest head, earliest run on ties
+   auto later = [&runs, &positions](size_t a, size_t b) {
+       const DataType& left = runs[a][positions[a]];
+       const DataType& right = runs[b][positions[b]];
+       if (right < left) {
+           return true;
+       }
+       if (left < right) {
+           return false;
+       }
+       return a > b;
+   };
+   std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+   for (size_t i = 0; i < runs.size(); ++i) {
+       if (!runs[i].empty()) {
+           heap.push(i);
+       }
+   }
+   while (!heap.empty()) {
+       size_t run = heap.top();
+       heap.pop();
+       merged.push_back(std::move(runs[run][positions[run]]));
+       if (++positions[run] < runs[run].size()) {
+           heap.push(run);
+       } else {
+           std::vector<DataType>().swap(runs[run]); // Release each run as soon as it is used up
+       }
+   }
+}
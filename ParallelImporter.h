@@ -0,0 +1,105 @@
+#ifndef PARALLEL_IMPORTER_H
+#define PARALLEL_IMPORTER_H
+#include <string>
+#include <vector>
+#include "MappedRecordReader.h"
+/**
+ * Loads a newline-separated file into a sorted list using several threads.
+ *
+ * The import runs in three stages:
+ *   1. The file is cut into chunks of about chunkBytes. Each record belongs to the chunk it
+ *      starts in, so no chunk needs to know where its neighbours' records end.
+ *   2. Worker threads claim chunks one at a time, build an item from every record in the chunk,
+ *      and sort the chunk, producing one sorted run per chunk.
+ *   3. The runs are k-way merged into one sorted sequence, which is handed to the list's
+ *      putItems so it is merged into the list in a single pass.
+ *
+ * Items with equal keys keep their file order. DataType must be default constructible,
+ * movable, and constructible from a std::string or std::string_view.
+ *
+ * @param DataType The type of item built from each record.
+ */
+template <class DataType>
+class ParallelImporter {
+public:
+    static const long long DEFAULT_CHUNK_BYTES = 8 << 20; // Bytes per chunk unless told otherwise.
+
+    /**
+     * Wall-clock time spent in each stage of the last import, and what it processed.
+     */
+    struct Timings {
+        double splitMs;      // Cutting the file into chunks.
+        double parseMs;      // Building items, summed over all workers.
+        double sortMs;       // Sorting runs, summed over all workers.
+        double workersMs;    // Wall-clock time of the parse and sort stage.
+        double mergeMs;      // K-way merging the runs.
+        double insertMs;     // Handing the merged items to the list.
+        double totalMs;      // The whole import.
+        long long records;   // Items imported.
+        int chunks;          // Chunks the file was cut into.
+        int threads;         // Worker threads used.
+    };
+
+    /**
+     * Constructs an importer.
+     *
+     * @param threadCount Worker threads to use; 0 uses one per hardware thread.
+     * @param chunkBytes Target size of each chunk in bytes.
+     */
+    explicit ParallelImporter(int threadCount = 0, long long chunkBytes = DEFAULT_CHUNK_BYTES);
+
+    /**
+     * Retrieves the number of worker threads.
+     *
+     * @return The thread count.
+     */
+    int getThreadCount() const;
+
+    /**
+     * Retrieves the target chunk size.
+     *
+     * @return The chunk size in bytes.
+     */
+    long long getChunkBytes() const;
+
+    /**
+     * Imports every record of a file into a list that provides putItems.
+     *
+     * @param filename Path of the file.
+     * @param list The list to add the items to; items already in it are kept.
+     * @param skipHeader True to ignore the first line of the file.
+     * @return Timings for each stage.
+     * @throw std::runtime_error if the file cannot be opened or mapped; anything thrown while
+     *        building an item is rethrown, and the list is left unchanged.
+     */
+    template <class List>
+    Timings importInto(const std::string& filename, List& list, bool skipHeader = true) const;
+
+private:
+    int threads;          // Worker threads to start.
+    long long chunkBytes; // Target bytes per chunk.
+
+    /**
+     * Parses and sorts every chunk on the worker threads.
+     *
+     * @param reader The open file.
+     * @param bounds Chunk boundaries; chunk i covers [bounds[i], bounds[i + 1]).
+     * @param skipHeader True to ignore the first line of the file.
+     * @param runs Receives one sorted run per chunk.
+     * @param timings Receives the parse and sort times.
+     */
+    void buildRuns(const MappedRecordReader& reader, const std::vector<long long>& bounds, bool skipHeader,
+                   std::vector<std::vector<DataType> >& runs, Timings& timings) const;
+
+    /**
+     * Merges sorted runs into one sorted sequence, taking the earlier run first on ties.
+     *
+     * @param runs The runs to merge; their items are moved out.
+     * @param merged Receives every item in order.
+     */
+    static void mergeRuns(std::vector<std::vector<DataType> >& runs, std::vector<DataType>& merged);
+};
+
+#include "ParallelImporter.cpp"
+
+#endif // PARALLEL_IMPORTER_H
@@ -0,0 +1,369 @@
+#include <climits>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ArrayADTList.h"
+#include "BTreeADTList.h"
+#include "GappedADTList.h"
+#include "KeyedArrayADTList.h"
+#include "ListStats.h"
+#include "LinkedADTList.h"
+#include "NodeAllocators.h"
+#include "OrderedList.h"
+#include "SkipADTList.h"
+#include "UnrolledADTList.h"
+
+/**
+ * A string whose copies or comparisons throw once a shared budget runs out, to fail an operation partway through.
+ */
+struct FragileWord {
+    static int copiesLeft; // Copies allowed before the next one throws
+    static int comparesLeft; // Comparisons allowed before the next one throws
+    std::string text;
+
+    FragileWord() {}
+    FragileWord(const std::string& text) : text(text) {}
+    FragileWord(const FragileWord& other) : text(other.text) { spend(); }
+    FragileWord(FragileWord&& other) noexcept : text(std::move(other.text)) {}
+    FragileWord& operator=(const FragileWord& other) { spend(); text = other.text; return *this; }
+    FragileWord& operator=(FragileWord&& other) noexcept { text = std::move(other.text); return *this; }
+
+    bool operator<(const FragileWord& other) const { compare(); return text < other.text; }
+    bool operator==(const FragileWord& other) const { return text == other.text; }
+    bool operator!=(const FragileWord& other) const { return text != other.text; }
+
+    static void spend() {
+        if (copiesLeft-- <= 0) {
+            throw std::runtime_error("copy budget spent");
+        }
+    }
+
+    static void compare() {
+        if (comparesLeft-- <= 0) {
+            throw std::runtime_error("comparison budget spent");
+        }
+    }
+};
+
+int FragileWord::copiesLeft = INT_MAX;
+int FragileWord::comparesLeft = INT_MAX;
+
+/**
+ * An item ordered by its key alone, with a tag telling apart items whose keys are equal.
+ */
+struct TaggedKey {
+    int key;
+    int tag;
+
+    TaggedKey(int key = 0, int tag = 0) : key(key), tag(tag) {}
+
+    bool operator<(const TaggedKey& other) const { return key < other.key; }
+    bool operator==(const TaggedKey& other) const { return key == other.key; }
+    bool operator!=(const TaggedKey& other) const { return key != other.key; }
+};
+
+/**
+ * A record keyed by a FragileWord, holding a shared owner so a check can tell whether the list still keeps it.
+ */
+struct KeyedRecord {
+    FragileWord key;
+    std::shared_ptr<int> owner;
+};
+
+typedef KeyedArrayADTList<KeyedRecord, KeyFrom<&KeyedRecord::key> > KeyedRecordList;
+
+// Every backend must provide the ordered-list contract
+static_assert(IsOrderedList<OrderedList<std::string, ArrayBackend>, std::string>::value, "ArrayBackend breaks the contract");
+static_assert(IsOrderedList<OrderedList<std::string, LinkedBackend>, std::string>::value, "LinkedBackend breaks the contract");
+static_assert(IsOrderedList<OrderedList<std::string, GappedBackend>, std::string>::value, "GappedBackend breaks the contract");
+static_assert(IsOrderedList<OrderedList<std::string, BTreeBackend>, std::string>::value, "BTreeBackend breaks the contract");
+static_assert(IsOrderedList<OrderedList<std::string>, std::string>::value, "AutoBackend breaks the contract");
+static_assert(IsOrderedList<OrderedList<TaggedKey, AutoBackend<1000000, 50> >, TaggedKey>::value, "AutoBackend breaks the contract");
+
+// Function prototypes
+std::string makeWord(int number);
+template <class List> bool checkSelfInsert(int count, int rounds);
+template <class List> bool checkFailedCopy(int count);
+template <class List> bool holdsWords(List& list, const std::string& prefix, int count);
+bool checkFailedUnion(int count);
+template <class List> bool checkFailedLinkedUnion(int count);
+template <class Backend> bool checkEqualOrder(int count, int copies);
+template <class List> bool checkBatchOrder(int count, int copies);
+bool checkFailedRelocate(int count);
+bool checkEmptyReleases(int count);
+int report(const char* name, bool passed);
+
+int main() {
+   int failures = 0;
+
+   // Insert items the list already holds, taken by reference from its own storage
+   failures += report("ArrayADTList self-insert while full", checkSelfInsert<ArrayADTList<std::string> >(100, 200));
+   failures += report("GappedADTList self-insert into full segments", checkSelfInsert<GappedADTList<std::string> >(100, 200));
+   failures += report("UnrolledADTList self-insert into full nodes", checkSelfInsert<UnrolledADTList<std::string> >(100, 200));
+   failures += report("BTreeADTList self-insert into full leaves", checkSelfInsert<BTreeADTList<std::string, 4, 4> >(100, 200));
+
+   // Let an item copy throw at every point of a copy assignment; the target must keep its contents
+   failures += report("GappedADTList assignment with a throwing copy", checkFailedCopy<GappedADTList<FragileWord> >(60));
+   failures += report("SkipADTList assignment with a throwing copy", checkFailedCopy<SkipADTList<FragileWord> >(60));
+   failures += report("UnrolledADTList assignment with a throwing copy", checkFailedCopy<UnrolledADTList<FragileWord> >(60));
+   failures += report("ArrayADTList union with a throwing copy", checkFailedUnion(60));
+   failures += report("LinkedADTList union with a throwing comparison",
+                      checkFailedLinkedUnion<LinkedADTList<FragileWord> >(60));
+   failures += report("LinkedADTList union with a throwing comparison, pooled",
+                      checkFailedLinkedUnion<LinkedADTList<FragileWord, NodePool> >(60));
+
+   // putItem must place an item after any equal items on every backend
+   failures += report("ArrayBackend puts equal items last", checkEqualOrder<ArrayBackend>(50, 4));
+   failures += report("LinkedBackend puts equal items last", checkEqualOrder<LinkedBackend>(50, 4));
+   failures += report("GappedBackend puts equal items last", checkEqualOrder<GappedBackend>(50, 4));
+   failures += report("BTreeBackend puts equal items last", checkEqualOrder<BTreeBackend>(50, 4));
+
+   // putItems must order equal items as putItem does, and record its work like the other mutators
+   failures += report("ArrayADTList putItems matches putItem",
+                      checkBatchOrder<ArrayADTList<TaggedKey, DefaultSearchPolicy<TaggedKey>, CountingStats> >(50, 4));
+   failures += report("LinkedADTList putItems matches putItem",
+                      checkBatchOrder<LinkedADTList<TaggedKey, HeapNodeAllocator, CountingStats> >(50, 4));
+
+   // Keys live apart from the items, so both must survive a failed relocation, and emptying must free the items
+   failures += report("KeyedArrayADTList shrinkToFit with a throwing key copy", checkFailedRelocate(60));
+   failures += report("KeyedArrayADTList makeEmpty releases the items", checkEmptyReleases(60));
+
+   std::cout << (failures == 0 ? "All checks passed." : "Some checks failed.") << std::endl;
+   return failures == 0 ? 0 : 1;
+}
+
+// Function implementations
+
+// Builds a string too long for the small-string buffer, so a read of freed storage shows up
+std::string makeWord(int number) {
+   std::string digits = std::to_string(number);
+   return "item " + std::string(6 - digits.size(), '0') + digits + " padded past the small-string buffer";
+}
+
+// Fills a list, then puts copies of its own items back in by reference, walking further into the list each round
+template <class List>
+bool checkSelfInsert(int count, int rounds) {
+   List list;
+   for (int i = 0; i < count; ++i) {
+       list.putItem(makeWord(i));
+   }
+   for (int round = 0; round < rounds; ++round) {
+       auto it = list.begin();
+       for (int step = 0; step < (round * 7) % list.getLength(); ++step) {
+           ++it;
+       }
+       list.putItem(*it); // The reference points into the list's storage
+   }
+
+   if (list.getLength() != count + rounds) {
+       return false;
+   }
+   std::string previous;
+   for (auto it = list.begin(); it != list.end(); ++it) {
+       if ((*it).empty() || *it < previous) {
+           return false; // A moved-from or misplaced item
+       }
+       previous = *it;
+   }
+   std::string found;
+   for (int i = 0; i < count; ++i) {
+       if (!list.getItem(makeWord(i), found) || found != makeWord(i)) {
+           return false;
+       }
+   }
+   return true;
+}
+
+// Assigns a larger list over a smaller one with the copy budget set to every value in turn
+template <class List>
+bool checkFailedCopy(int count) {
+   List source, target;
+   for (int i = 0; i < count; ++i) {
+       source.putItem(FragileWord("source " + makeWord(i)));
+   }
+   for (int i = 0; i < 5; ++i) {
+       target.putItem(FragileWord("target " + makeWord(i)));
+   }
+   for (int budget = 0; budget <= count; ++budget) {
+       List attempt(target);
+       bool threw = false;
+       FragileWord::copiesLeft = budget;
+       try {
+           attempt = source;
+       } catch (const std::runtime_error&) {
+           threw = true;
+       }
+       FragileWord::copiesLeft = INT_MAX;
+       if (threw ? !holdsWords(attempt, "target ", 5) : !holdsWords(attempt, "source ", count)) {
+           return false;
+       }
+       attempt.putItem(FragileWord("target " + makeWord(count))); // Inserting must still work
+       if (!holdsWords(attempt, "", threw ? 6 : count + 1)) {
+           return false;
+       }
+   }
+   return true;
+}
+
+// Merges interleaved lists with the copy budget set to every value in turn; our items move, theirs are copied
+bool checkFailedUnion(int count) {
+   ArrayADTList<FragileWord> ours, theirs;
+   for (int i = 0; i < count; ++i) {
+       (i % 3 == 0 ? theirs : ours).putItem(FragileWord(makeWord(i)));
+   }
+   for (int budget = 0; budget <= count; ++budget) {
+       ArrayADTList<FragileWord> attempt(ours);
+       bool threw = false;
+       FragileWord::copiesLeft = budget;
+       try {
+           attempt.unionWith(theirs);
+       } catch (const std::runtime_error&) {
+           threw = true;
+       }
+       FragileWord::copiesLeft = INT_MAX;
+       if (!holdsWords(attempt, "", threw ? ours.getLength() : count)) {
+           return false;
+       }
+       auto expected = ours.begin();
+       for (auto it = attempt.begin(); threw && it != attempt.end(); ++it, ++expected) {
+           if ((*it).text != (*expected).text) {
+               return false; // A moved-from item left behind by the failed merge
+           }
+       }
+   }
+   return true;
+}
+
+// Merges interleaved linked lists with the comparison budget set to every value in turn; both must survive a throw
+template <class List>
+bool checkFailedLinkedUnion(int count) {
+   List ours, theirs;
+   for (int i = 0; i < count; ++i) {
+       (i % 3 == 0 ? theirs : ours).putItem(FragileWord(makeWord(i)));
+   }
+   for (int budget = 0; budget <= 2 * count; ++budget) {
+       List attempt(ours), donor(theirs);
+       bool threw = false;
+       FragileWord::comparesLeft = budget;
+       try {
+           attempt.unionWith(donor);
+       } catch (const std::runtime_error&) {
+           threw = true;
+       }
+       FragileWord::comparesLeft = INT_MAX;
+       if (!threw) {
+           return holdsWords(attempt, "", count) && holdsWords(donor, "", 0);
+       }
+       if (!holdsWords(attempt, "", ours.getLength()) || !holdsWords(donor, "", theirs.getLength())) {
+           return false; // A node lost or left in the wrong list by the failed merge
+       }
+   }
+   return false; // The budget never ran high enough for the merge to finish
+}
+
+// Puts several items with each key, in tag order but with the keys shuffled, and checks the tags stay in order
+template <class Backend>
+bool checkEqualOrder(int count, int copies) {
+   OrderedList<TaggedKey, Backend> list;
+   for (int tag = 0; tag < copies; ++tag) {
+       for (int i = 0; i < count; ++i) {
+           list.putItem(TaggedKey((i * 17) % count, tag));
+       }
+   }
+   int expectedKey = 0, expectedTag = 0;
+   for (auto it = list.begin(); it != list.end(); ++it) {
+       if ((*it).key != expectedKey || (*it).tag != expectedTag) {
+           return false;
+       }
+       if (++expectedTag == copies) {
+           expectedTag = 0;
+           expectedKey++;
+       }
+   }
+   return expectedKey == count && expectedTag == 0;
+}
+
+// Loads the same tagged items into one list by putItem and into another by putItems over existing items
+template <class List>
+bool checkBatchOrder(int count, int copies) {
+   List single, batched;
+   std::vector<TaggedKey> batch;
+   for (int tag = 0; tag < copies; ++tag) {
+       for (int i = 0; i < count; ++i) {
+           TaggedKey item((i * 17) % count, tag);
+           single.putItem(item);
+           if (tag < copies / 2) {
+               batched.putItem(item); // Already in the list when the batch arrives
+           } else {
+               batch.push_back(item);
+           }
+       }
+   }
+   long long calls = batched.getStats().getCalls(STATS_PUT);
+   batched.putItems(batch.begin(), batch.end());
+   if (batched.getStats().getCalls(STATS_PUT) != calls + 1) {
+       return false;
+   }
+   auto expected = single.begin();
+   for (auto it = batched.begin(); it != batched.end(); ++it, ++expected) {
+       if (expected == single.end() || (*it).key != (*expected).key || (*it).tag != (*expected).tag) {
+           return false;
+       }
+   }
+   return expected == single.end();
+}
+
+// Shrinks a keyed list with the copy budget set to every value in turn; every item must still be found
+bool checkFailedRelocate(int count) {
+   for (int budget = 0; budget <= count; ++budget) {
+       KeyedRecordList list;
+       for (int i = 0; i < count; ++i) {
+           list.putItem(KeyedRecord{FragileWord(makeWord(i)), std::make_shared<int>(i)});
+       }
+       FragileWord::copiesLeft = budget;
+       try {
+           list.shrinkToFit();
+       } catch (const std::runtime_error&) {
+       }
+       FragileWord::copiesLeft = INT_MAX;
+       KeyedRecord found;
+       for (int i = 0; i < count; ++i) {
+           if (!list.getItem(FragileWord(makeWord(i)), found) || found.owner == nullptr || *found.owner != i) {
+               return false; // A moved-from item left behind by the failed relocation
+           }
+       }
+   }
+   return true;
+}
+
+// Empties a keyed list and checks that it no longer holds a reference to any item
+bool checkEmptyReleases(int count) {
+   std::shared_ptr<int> owner = std::make_shared<int>(0);
+   KeyedRecordList list;
+   for (int i = 0; i < count; ++i) {
+       list.putItem(KeyedRecord{FragileWord(makeWord(i)), owner});
+   }
+   list.deleteItem(KeyedRecord{FragileWord(makeWord(0)), nullptr});
+   list.makeEmpty();
+   return owner.use_count() == 1 && list.getLength() == 0;
+}
+
+// Checks that a list holds exactly prefix + makeWord(i) for i below count, in order (any words if prefix is empty)
+template <class List>
+bool holdsWords(List& list, const std::string& prefix, int count) {
+   int i = 0;
+   for (auto it = list.begin(); it != list.end(); ++it, ++i) {
+       if (!prefix.empty() && (i >= count || (*it).text != prefix + makeWord(i))) {
+           return false;
+       }
+   }
+   return i == count && list.getLength() == count;
+}
+
+// Prints the outcome of one check and returns 1 if it failed
+int report(const char* name, bool passed) {
+   std::cout << (passed ? "pass: " : "FAIL: ") << name << std::endl;
+   return passed ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "ArrayADTList.h"
+#include "KeyedArrayADTList.h"
+
+// Receives the lookup results so the timed loops cannot be discarded
+volatile long long lookupSink = 0;
+
+// A record about the size of a Customer, searched by its integer id
+struct Record {
+   int id;
+   std::string name;
+   std::string email;
+   char notes[64];
+};
+
+// Reads a record's id
+struct RecordId {
+   int operator()(const Record& record) const { return record.id; }
+};
+
+// Function prototypes
+template <typename SearchPolicy>
+double timeLookups(const std::vector<int>& keys, const std::vector<int>& probes);
+template <typename List>
+double timeRecordLookups(const std::vector<Record>& records, const std::vector<int>& probes);
+void benchmarkSize(int size, int lookups);
+void benchmarkRecords(int size, int lookups);
+
+int main() {
+   using namespace std;
+
+   // Compare the search policies on lists that fit in cache and on lists well beyond L2
+   cout << "ArrayADTList<int> getItem cost per lookup (ns):" << endl;
+   cout << "size\tbinary\tbranchless\teytzinger\tsimd\thash" << endl;
+   benchmarkSize(1 << 10, 1 << 20);
+   benchmarkSize(1 << 16, 1 << 20);
+   benchmarkSize(1 << 20, 1 << 20);
+   benchmarkSize(1 << 23, 1 << 20);
+
+   // Compare whole records in one array with the keys split out into their own dense array
+   cout << endl << "Record getItem by id, cost per lookup (ns):" << endl;
+   cout << "size\tarray\tkeyed-binary\tkeyed-simd" << endl;
+   benchmarkRecords(1 << 10, 1 << 20);
+   benchmarkRecords(1 << 16, 1 << 20);
+   benchmarkRecords(1 << 20, 1 << 20);
+
+   return 0;
+}
+
+// Function implementations
+
+// Loads the keys into a list using SearchPolicy and times random getItem calls against it
+template <typename SearchPolicy>
+double timeLookups(const std::vector<int>& keys, const std::vector<int>& probes) {
+   ArrayADTList<int, SearchPolicy> list;
+   list.putItems(keys.begin(), keys.end());
+
+   int found;
+   list.getItem(probes[0], found); // Let lazily built indexes finish before timing
+
+   long long hits = 0;
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < probes.size(); ++i) {
+       hits += list.getItem(probes[i], found) ? 1 : 0;
+   }
+   std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+   lookupSink = lookupSink + hits; // Keep the lookups from being optimized away
+   return std::chrono::duration<double, std::nano>(stop - start).count() / probes.size();
+}
+
+// Runs every search policy over one list size and prints a row of results
+void benchmarkSize(int size, int lookups) {
+   std::mt19937 random(42);
+   std::vector<int> keys(size);
+   for (int i = 0; i < size; ++i) {
+       keys[i] = 2 * i; // Even keys, so odd probes exercise the miss path
+   }
+
+   std::uniform_int_distribution<int> pick(0, 2 * size);
+   std::vector<int> probes(lookups);
+   for (int i = 0; i < lookups; ++i) {
+       probes[i] = pick(random);
+   }
+
+   std::cout << size
+             << "\t" << timeLookups<BinarySearchPolicy<int> >(keys, probes)
+             << "\t" << timeLookups<BranchlessSearchPolicy<int> >(keys, probes)
+             << "\t" << timeLookups<EytzingerSearchPolicy<int> >(keys, probes)
+             << "\t" << timeLookups<SimdSearchPolicy<int> >(keys, probes)
+             << "\t" << timeLookups<HashSearchPolicy<int> >(keys, probes)
+             << std::endl;
+}
+
+// Loads the records into a list and times random getItem calls by id against it
+template <typename List>
+double timeRecordLookups(const std::vector<Record>& records, const std::vector<int>& probes) {
+   List list;
+   list.putItems(records.begin(), records.end());
+
+   Record found;
+   long long hits = 0;
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < probes.size(); ++i) {
+       hits += list.getItem(probes[i], found) ? 1 : 0;
+   }
+   std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+   lookupSink = lookupSink + hits;
+   return std::chrono::duration<double, std::nano>(stop - start).count() / probes.size();
+}
+
+// Runs the record layouts over one list size and prints a row of results
+void benchmarkRecords(int size, int lookups) {
+   std::mt19937 random(42);
+   std::vector<Record> records(size);
+   for (int i = 0; i < size; ++i) {
+       records[i].id = 2 * i;
+       records[i].name = "Customer number " + std::to_string(i);
+       records[i].email = "customer" + std::to_string(i) + "@example.com";
+   }
+
+   std::uniform_int_distribution<int> pick(0, 2 * size);
+   std::vector<int> probes(lookups);
+   for (int i = 0; i < lookups; ++i) {
+       probes[i] = pick(random);
+   }
+
+   typedef KeyOrder<Record, RecordId> ById;
+   std::cout << size
+             << "\t" << timeRecordLookups<ArrayADTList<Record, BinarySearchPolicy<Record, ById> > >(records, probes)
+             << "\t" << timeRecordLookups<KeyedArrayADTList<Record, RecordId, BinarySearchPolicy<int> > >(records, probes)
+             << "\t" << timeRecordLookups<KeyedArrayADTList<Record, RecordId> >(records, probes)
+             << std::endl;
+}
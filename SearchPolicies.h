@@ -0,0 +1,558 @@
+#ifndef SEARCH_POLICIES_H
+#define SEARCH_POLICIES_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include "ListOrdering.h"
+#include "ListStats.h"
+#include "SimdSearch.h"
+
+/**
+ * Search policies used by ArrayADTList to locate items in its sorted buffer.
+ *
+ * Every policy names the ordering policy the buffer is sorted by (see ListOrdering.h),
+ * which the list adopts, and provides the same operations:
+ *   Order
+ *       The ordering policy; NaturalOrder<DataType> unless given as a template argument.
+ *   int lowerBound(const DataType* data, int size, const Key& key, Stats&& stats = NoStats()) const
+ *       Returns the index of the first element whose key is not less than key.
+ *   const DataType* find(const DataType* data, int size, const Key& key, Stats&& stats = NoStats()) const
+ *       Returns an element whose key equals key, or nullptr. The element may live in the
+ *       policy's own index rather than in the buffer.
+ * Both count the elements they compare against key as they go and pass the total to
+ * stats.addProbes (see ListStats.h); with the default NoStats the count compiles away.
+ *   void inserted(const DataType* data, int size, int index)
+ *       Called by the list after one item has been inserted at index.
+ *   void erasing(const DataType* data, int size, int index)
+ *       Called by the list just before the item at index is removed.
+ *   void invalidate()
+ *       Called by the list whenever its contents change in any other way.
+ *
+ * @param DataType The type of data stored in the list.
+ * @param Order How the buffer is sorted; see ListOrdering.h.
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SEARCH_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define SEARCH_PREFETCH(address) ((void)0)
+#endif
+
+/**
+ * Textbook binary search over the sorted buffer. Keeps no state of its own.
+ */
+template <typename DataType, typename OrderPolicy = NaturalOrder<DataType> >
+class BinarySearchPolicy {
+public:
+   typedef OrderPolicy Order;
+
+   /**
+    * Finds the first position whose element is not less than key.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared.
+    * @return The index of the lower bound, or size if every element is less than key.
+    */
+   template <typename Stats = NoStats>
+   int lowerBound(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      int low = 0;
+      int high = size;
+      int probes = 0;
+      while (low < high) {
+         int mid = low + (high - low) / 2;
+         ++probes;
+         if (Order::less(Order::key(data[mid]), key)) {
+            low = mid + 1; // Item is greater, ignore the left half
+         } else {
+            high = mid; // Item is smaller or equal, ignore the right half
+         }
+      }
+      stats.addProbes(probes);
+      return low;
+   }
+
+   /**
+    * Looks for an element whose key equals key.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared, including the final equality check.
+    * @return A pointer to the matching element in the buffer, or nullptr if there is none.
+    */
+   template <typename Stats = NoStats>
+   const DataType* find(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      int index = lowerBound(data, size, key, stats);
+      stats.addProbes(index < size ? 1 : 0);
+      return (index < size && Order::equal(Order::key(data[index]), key)) ? data + index : nullptr;
+   }
+
+   /**
+    * Nothing is cached, so changes to the list need no bookkeeping.
+    */
+   void inserted(const DataType*, int, int) {}
+   void erasing(const DataType*, int, int) {}
+   void invalidate() {}
+};
+
+/**
+ * Branchless lower bound: one comparison per level, resolved with a conditional move
+ * instead of a branch, and both possible next probes prefetched ahead of time.
+ */
+template <typename DataType, typename OrderPolicy = NaturalOrder<DataType> >
+class BranchlessSearchPolicy {
+public:
+   typedef OrderPolicy Order;
+
+   /**
+    * Finds the first position whose element is not less than key.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared.
+    * @return The index of the lower bound, or size if every element is less than key.
+    */
+   template <typename Stats = NoStats>
+   int lowerBound(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      if (size == 0) {
+         return 0;
+      }
+      const DataType* base = data;
+      int remaining = size;
+      int probes = 1; // The final comparison below
+      while (remaining > 1) {
+         int half = remaining / 2;
+         SEARCH_PREFETCH(base + half / 2); // Next probe if we stay in the lower half
+         SEARCH_PREFETCH(base + half + half / 2); // Next probe if we move to the upper half
+         base = Order::less(Order::key(base[half]), key) ? base + half : base;
+         remaining -= half;
+         ++probes;
+      }
+      stats.addProbes(probes);
+      return static_cast<int>(base - data) + (Order::less(Order::key(*base), key) ? 1 : 0);
+   }
+
+   /**
+    * Looks for an element whose key equals key.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared, including the final equality check.
+    * @return A pointer to the matching element in the buffer, or nullptr if there is none.
+    */
+   template <typename Stats = NoStats>
+   const DataType* find(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      int index = lowerBound(data, size, key, stats);
+      stats.addProbes(index < size ? 1 : 0);
+      return (index < size && Order::equal(Order::key(data[index]), key)) ? data + index : nullptr;
+   }
+
+   /**
+    * Nothing is cached, so changes to the list need no bookkeeping.
+    */
+   void inserted(const DataType*, int, int) {}
+   void erasing(const DataType*, int, int) {}
+   void invalidate() {}
+};
+
+/**
+ * Vectorized search for arithmetic DataTypes: a few branchless binary-search levels narrow the
+ * range to a small block, and SimdSearch finishes it with a vector compare-and-count.
+ */
+template <typename DataType>
+class SimdSearchPolicy {
+   static_assert(std::is_arithmetic<DataType>::value, "SimdSearchPolicy requires an arithmetic DataType");
+
+public:
+   typedef NaturalOrder<DataType> Order; // Vector compares only know the natural order
+
+   /**
+    * Finds the first position whose element is not less than item.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param item The item being searched for.
+    * @param stats Receives the number of elements compared, counting every lane of the block scan.
+    * @return The index of the lower bound, or size if every element is less than item.
+    */
+   template <typename Stats = NoStats>
+   int lowerBound(const DataType* data, int size, const DataType& item, Stats&& stats = Stats()) const {
+      return SimdSearch::lowerBound(data, size, item, stats);
+   }
+
+   /**
+    * Looks for an element whose key equals key.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared, including the final equality check.
+    * @return A pointer to the matching element in the buffer, or nullptr if there is none.
+    */
+   template <typename Stats = NoStats>
+   const DataType* find(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      int index = lowerBound(data, size, key, stats);
+      stats.addProbes(index < size ? 1 : 0);
+      return (index < size && Order::equal(Order::key(data[index]), key)) ? data + index : nullptr;
+   }
+
+   /**
+    * Nothing is cached, so changes to the list need no bookkeeping.
+    */
+   void inserted(const DataType*, int, int) {}
+   void erasing(const DataType*, int, int) {}
+   void invalidate() {}
+};
+
+/**
+ * Searches a shadow copy of the buffer stored in Eytzinger (breadth-first) order, so the
+ * first levels of every search share the same few cache lines. The shadow index is rebuilt
+ * lazily on the first search after the list changes, which makes this policy a good fit for
+ * lookup-heavy lists and a poor one for lists that interleave every lookup with a mutation.
+ *
+ * Because the rebuild happens inside const lookups, a list using this policy must not be
+ * searched from several threads at once without external synchronization.
+ */
+template <typename DataType, typename OrderPolicy = NaturalOrder<DataType> >
+class EytzingerSearchPolicy {
+public:
+   typedef OrderPolicy Order;
+
+private:
+   mutable std::vector<DataType> tree; // Elements in breadth-first order, 1-based
+   mutable std::vector<int> rank;      // Sorted position of each tree slot
+   mutable bool stale;                 // True when the tree no longer matches the list
+
+   /**
+    * Fills the tree with an in-order walk over the sorted buffer.
+    * @param data The sorted buffer.
+    * @param next The index of the next sorted element to place.
+    * @param slot The tree slot being filled.
+    * @param size The number of elements in the buffer.
+    * @return The index of the next sorted element after this subtree.
+    */
+   int fill(const DataType* data, int next, int slot, int size) const {
+      if (slot <= size) {
+         next = fill(data, next, 2 * slot, size);
+         tree[slot] = data[next];
+         rank[slot] = next++;
+         next = fill(data, next, 2 * slot + 1, size);
+      }
+      return next;
+   }
+
+   /**
+    * Rebuilds the shadow tree from the sorted buffer.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    */
+   void rebuild(const DataType* data, int size) const {
+      tree.assign(size + 1, DataType());
+      rank.assign(size + 1, size);
+      fill(data, 0, 1, size);
+      stale = false;
+   }
+
+   /**
+    * Walks the shadow tree, rebuilding it first if the list has changed.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of tree nodes compared.
+    * @return The tree slot holding the lower bound, or 0 if every element is less than key.
+    */
+   template <typename Stats>
+   int descend(const DataType* data, int size, const typename Order::Key& key, Stats& stats) const {
+      if (stale || static_cast<int>(tree.size()) != size + 1) {
+         rebuild(data, size);
+      }
+      const DataType* nodes = tree.data();
+      int k = 1;
+      int probes = 0;
+      while (k <= size) {
+         if (16 * k <= size) {
+            SEARCH_PREFETCH(nodes + 16 * k); // Four levels ahead share one prefetched block
+         }
+         k = 2 * k + (Order::less(Order::key(nodes[k]), key) ? 1 : 0);
+         ++probes;
+      }
+      stats.addProbes(probes);
+      // Undo the trailing right turns plus the final left turn to land on the answer.
+      while (k & 1) {
+         k >>= 1;
+      }
+      return k >> 1;
+   }
+
+public:
+   /**
+    * Constructs a policy whose index will be built on the first search.
+    */
+   EytzingerSearchPolicy() : stale(true) {}
+
+   /**
+    * Finds the first position whose element is not less than key.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of tree nodes compared.
+    * @return The index of the lower bound, or size if every element is less than key.
+    */
+   template <typename Stats = NoStats>
+   int lowerBound(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      int slot = descend(data, size, key, stats);
+      return slot == 0 ? size : rank[slot];
+   }
+
+   /**
+    * Looks for an element whose key equals key without touching the buffer at all.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of tree nodes compared, including the final equality check.
+    * @return A pointer to the matching element in the shadow tree, or nullptr if there is none.
+    */
+   template <typename Stats = NoStats>
+   const DataType* find(const DataType* data, int size, const typename Order::Key& key, Stats&& stats = Stats()) const {
+      int slot = descend(data, size, key, stats);
+      stats.addProbes(slot != 0 ? 1 : 0);
+      return (slot != 0 && Order::equal(Order::key(tree[slot]), key)) ? &tree[slot] : nullptr;
+   }
+
+   /**
+    * Marks the shadow tree as out of date so the next search rebuilds it.
+    */
+   void inserted(const DataType*, int, int) {
+      stale = true;
+   }
+
+   void erasing(const DataType*, int, int) {
+      stale = true;
+   }
+
+   void invalidate() {
+      stale = true;
+   }
+};
+
+/**
+ * Keeps an open-addressing hash table from each element to its position in the buffer beside
+ * the sorted buffer, so exact-match lookups take O(1) expected time instead of O(log n).
+ * Items the table does not hold fall back to a binary search, so lowerBound still works for
+ * any item. Single inserts and deletes patch the table in place, renumbering the positions
+ * after the change in one linear pass over the table; every other change drops the table, and
+ * it is rebuilt on the next search, so bulk loads pay for hashing only once.
+ *
+ * Items with equal keys must have equal hashes. Because the rebuild happens inside const
+ * lookups, a list using this policy must not be searched from several threads at once without
+ * external synchronization.
+ *
+ * @param Order The ordering policy whose keys are hashed.
+ * @param Hash The hash function over those keys; std::hash of the key type by default.
+ */
+template <typename DataType, typename OrderPolicy = NaturalOrder<DataType>,
+          typename Hash = std::hash<typename OrderPolicy::Key> >
+class HashSearchPolicy {
+public:
+   typedef OrderPolicy Order;
+
+private:
+   typedef typename Order::Key Key;
+
+   static const int EMPTY = -1;  // Slot never used since the last rebuild; ends a probe sequence
+   static const int ERASED = -2; // Slot whose item was deleted; probe sequences continue past it
+
+   /**
+    * One table entry: the item's position and part of its hash, checked before the item itself.
+    */
+   struct Slot {
+      std::uint32_t fingerprint;
+      int index;
+   };
+
+   mutable std::vector<Slot> slots; // A power of two in size, never more than half used
+   mutable int used;                // Slots that are not EMPTY
+   mutable int shift;               // 64 minus log2 of the table size
+   mutable bool stale;              // True when the table no longer matches the list
+   Hash hasher;
+
+   /**
+    * Hashes a key and spreads the bits with a Fibonacci multiply.
+    * @param key The key to hash.
+    * @return The mixed 64-bit hash.
+    */
+   std::uint64_t mix(const Key& key) const {
+      return static_cast<std::uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ULL;
+   }
+
+   /**
+    * Puts a position in the first free slot of its probe sequence.
+    * @param hash The mixed hash of the item at index.
+    * @param index The position to store.
+    */
+   void place(std::uint64_t hash, int index) const {
+      std::size_t mask = slots.size() - 1;
+      std::size_t at = static_cast<std::size_t>(hash >> shift);
+      while (slots[at].index >= 0) {
+         at = (at + 1) & mask;
+      }
+      used += slots[at].index == EMPTY ? 1 : 0;
+      slots[at] = Slot{static_cast<std::uint32_t>(hash), index};
+   }
+
+   /**
+    * Refills the table from the sorted buffer, sized so it is at most a quarter full.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    */
+   void rebuild(const DataType* data, int size) const {
+      int bits = 4;
+      while ((std::size_t(1) << bits) < static_cast<std::size_t>(size) * 4) {
+         ++bits;
+      }
+      slots.assign(std::size_t(1) << bits, Slot{0, EMPTY});
+      shift = 64 - bits;
+      used = 0;
+      for (int i = 0; i < size; ++i) {
+         place(mix(Order::key(data[i])), i);
+      }
+      stale = false;
+   }
+
+   /**
+    * Looks a key up in the table, rebuilding it first if the list has changed.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared; slots whose fingerprint differs cost none.
+    * @return The position of an element with that key, or -1 if there is none.
+    */
+   template <typename Stats>
+   int locate(const DataType* data, int size, const Key& key, Stats& stats) const {
+      if (stale) {
+         rebuild(data, size);
+      }
+      std::uint64_t hash = mix(key);
+      std::uint32_t fingerprint = static_cast<std::uint32_t>(hash);
+      std::size_t mask = slots.size() - 1;
+      int probes = 0;
+      for (std::size_t at = static_cast<std::size_t>(hash >> shift); slots[at].index != EMPTY; at = (at + 1) & mask) {
+         const Slot& slot = slots[at];
+         if (slot.index >= 0 && slot.fingerprint == fingerprint) {
+            ++probes;
+            if (Order::equal(Order::key(data[slot.index]), key)) {
+               stats.addProbes(probes);
+               return slot.index;
+            }
+         }
+      }
+      stats.addProbes(probes);
+      return -1;
+   }
+
+public:
+   /**
+    * Constructs a policy whose table will be built on the first search.
+    * @param hasher The hash function to use.
+    */
+   explicit HashSearchPolicy(const Hash& hasher = Hash()) : used(0), shift(64), stale(true), hasher(hasher) {}
+
+   /**
+    * Finds the first position whose element is not less than key: through the table, stepping
+    * back over any equal elements, when key is held, and by binary search otherwise.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared, in the table and in either walk.
+    * @return The index of the lower bound, or size if every element is less than key.
+    */
+   template <typename Stats = NoStats>
+   int lowerBound(const DataType* data, int size, const Key& key, Stats&& stats = Stats()) const {
+      int index = locate(data, size, key, stats);
+      int probes = 0;
+      if (index < 0) {
+         index = static_cast<int>(std::lower_bound(data, data + size, key, [&probes](const DataType& item, const Key& bound) {
+            ++probes;
+            return Order::less(Order::key(item), bound);
+         }) - data);
+      } else {
+         while (index > 0 && (++probes, !Order::less(Order::key(data[index - 1]), key))) {
+            --index;
+         }
+      }
+      stats.addProbes(probes);
+      return index;
+   }
+
+   /**
+    * Looks for an element whose key equals key in O(1) expected time.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param key The key being searched for.
+    * @param stats Receives the number of elements compared.
+    * @return A pointer to a matching element in the buffer, or nullptr if there is none.
+    */
+   template <typename Stats = NoStats>
+   const DataType* find(const DataType* data, int size, const Key& key, Stats&& stats = Stats()) const {
+      int index = locate(data, size, key, stats);
+      return index < 0 ? nullptr : data + index;
+   }
+
+   /**
+    * Renumbers the positions the insert shifted and adds the new item, unless the table is
+    * already stale or would pass half full, in which case it is left to be rebuilt.
+    * @param data The sorted buffer, already holding the new item.
+    * @param index The position of the new item.
+    */
+   void inserted(const DataType* data, int, int index) {
+      if (stale || static_cast<std::size_t>(used + 1) * 2 > slots.size()) {
+         stale = true;
+         return;
+      }
+      for (Slot& slot : slots) {
+         slot.index += slot.index >= index ? 1 : 0;
+      }
+      place(mix(Order::key(data[index])), index);
+   }
+
+   /**
+    * Marks the item's slot as erased and renumbers the positions the delete will shift.
+    * @param data The sorted buffer, still holding the item.
+    * @param index The position of the item about to be removed.
+    */
+   void erasing(const DataType* data, int, int index) {
+      if (stale) {
+         return;
+      }
+      std::uint64_t hash = mix(Order::key(data[index]));
+      std::size_t mask = slots.size() - 1;
+      std::size_t at = static_cast<std::size_t>(hash >> shift);
+      while (slots[at].index != index) {
+         at = (at + 1) & mask;
+      }
+      slots[at].index = ERASED;
+      for (Slot& slot : slots) {
+         slot.index -= slot.index > index ? 1 : 0;
+      }
+   }
+
+   /**
+    * Marks the table as out of date so the next search rebuilds it.
+    */
+   void invalidate() {
+      stale = true;
+   }
+};
+
+/**
+ * The policy ArrayADTList uses when none is given: vectorized search for arithmetic types in
+ * their natural order, the textbook binary search for everything else.
+ */
+template <typename DataType, typename Order = NaturalOrder<DataType> >
+using DefaultSearchPolicy = typename std::conditional<std::is_arithmetic<DataType>::value && Order::NATURAL,
+                                                      SimdSearchPolicy<DataType>,
+                                                      BinarySearchPolicy<DataType, Order> >::type;
+
+#endif
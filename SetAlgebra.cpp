@@ -0,0 +1,32 @@
+#include <algorithm>
+#include "SetAlgebra.h"
+
+// The non-template definitions live in a header-included file, so they are marked inline.
+
+// Should gallop: Gallops on request, or when one list dwarfs the other
+inline bool SetAlgebra::shouldGallop(SetAlgebraMode mode, int left, int right) {
+   if (mode != SET_AUTO) {
+       return mode == SET_GALLOP;
+   }
+   int shorter = std::min(left, right);
+   int longer = std::max(left, right);
+   return longer / GALLOP_RATIO >= (shorter > 0 ? shorter : 1);
+}
+
+// Advance: Doubles the step until it overshoots, then binary searches the last step
+template <typename Order, typename DataType>
+int SetAlgebra::advance(const DataType* data, int from, int size, const DataType& item, bool gallop) {
+   if (!gallop) {
+       return from + 1; // The caller compares again before moving any further
+   }
+   int below = from;   // Known to hold an item less than item
+   int step = 1;
+   while (step < size - from && Order::before(data[from + step], item)) {
+       below = from + step;
+       step = step > (size - from) / 2 ? size - from : step * 2; // Never overflows int
+   }
+   int above = step < size - from ? from + step : size;
+   return static_cast<int>(std::lower_bound(data + below + 1, data + above, item, [](const DataType& a, const DataType& b) {
+       return Order::before(a, b);
+   }) - data);
+}
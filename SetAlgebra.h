@@ -0,0 +1,61 @@
+#ifndef SET_ALGEBRA_H
+#define SET_ALGEBRA_H
+/**
+ * Shared pieces of the set operations (unionWith, intersectWith, subtract) on the list classes.
+ *
+ * The operations treat both lists as sorted multisets, with the same rules as std::set_union,
+ * std::set_intersection and std::set_difference: an item that appears m times in one list and
+ * n times in the other appears max(m, n), min(m, n) or max(m - n, 0) times in the result.
+ *
+ * A plain merge compares every item of both lists once, which is ideal when they are of
+ * similar size. When one list is much smaller, galloping skips over runs of the larger list
+ * with an exponential search followed by a binary search, so the work grows with
+ * small * log(large / small) instead of small + large.
+ */
+
+/**
+ * How a set operation walks its two inputs.
+ */
+enum SetAlgebraMode {
+    SET_MERGE,  // Step through both lists one item at a time.
+    SET_GALLOP, // Skip runs with an exponential search.
+    SET_AUTO    // Gallop only when one list is at least GALLOP_RATIO times longer than the other.
+};
+
+/**
+ * Search helpers used by the set operations on array-backed lists.
+ */
+class SetAlgebra {
+public:
+    static const int GALLOP_RATIO = 16; // Size ratio at which SET_AUTO starts galloping.
+
+    /**
+     * Decides whether an operation on lists of the given lengths should gallop.
+     *
+     * @param mode The mode the caller asked for.
+     * @param left The length of one list.
+     * @param right The length of the other list.
+     * @return True for SET_GALLOP, false for SET_MERGE, and the size heuristic for SET_AUTO.
+     */
+    static bool shouldGallop(SetAlgebraMode mode, int left, int right);
+
+    /**
+     * Finds the first position in [from, size) whose item is not less than item, given that
+     * data[from] is less than it. Galloping probes from + 1, from + 2, from + 4, ... until it
+     * overshoots, then binary searches the last step; a plain merge just moves one place on.
+     *
+     * @param data The sorted items.
+     * @param from A position whose item is known to be less than item.
+     * @param size The number of items.
+     * @param item The item to compare against.
+     * @param gallop True to search exponentially, false to advance by a single position.
+     * @param Order The ordering policy the items are sorted by; see ListOrdering.h.
+     * @return The position found, or size if there is none.
+     */
+    template <typename Order, typename DataType>
+    static int advance(const DataType* data, int from, int size, const DataType& item, bool gallop);
+};
+
+#include "SetAlgebra.cpp"
+
+#endif // SET_ALGEBRA_H
@@ -0,0 +1,211 @@
+#ifndef SIMD_SEARCH_H
+#define SIMD_SEARCH_H
+
+#include <type_traits>
+#include "ListStats.h"
+
+/**
+ * Vectorized search kernels for sorted buffers of arithmetic values.
+ *
+ * Binary search narrows the range down to a small block, and a vector compare counts how
+ * many elements of that block fall below the key. 32- and 64-bit signed integers, float and
+ * double use AVX2 when the CPU reports it at run time, SSE2 otherwise (64-bit integers have
+ * no SSE2 compare and stay scalar there). Every other arithmetic type, and every non-x86
+ * build, uses the scalar loop.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SIMD_SEARCH_X86 1
+#define SIMD_SEARCH_AVX2 __attribute__((target("avx2")))
+#define SIMD_SEARCH_SSE2 __attribute__((target("sse2")))
+#else
+#define SIMD_SEARCH_X86 0
+#endif
+
+class SimdSearch {
+public:
+   /**
+    * Number of elements below which the binary search hands over to a linear vector scan.
+    */
+   static const int BLOCK = 64;
+
+   /**
+    * Finds the first position whose element is not less than item.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param item The item being searched for.
+    * @param stats Receives the number of elements compared, counting every element of the final block.
+    * @return The index of the lower bound, or size if every element is less than item.
+    */
+   template <typename DataType, typename Stats = NoStats>
+   static int lowerBound(const DataType* data, int size, DataType item, Stats&& stats = Stats()) {
+      const DataType* base = data;
+      int probes = 0;
+      while (size > BLOCK) {
+         int half = size / 2;
+         prefetch(base + half / 2); // Next probe if we stay in the lower half
+         prefetch(base + half + half / 2); // Next probe if we move to the upper half
+         base = (base[half] < item) ? base + half : base;
+         size -= half;
+         ++probes;
+      }
+      stats.addProbes(probes + size);
+      return static_cast<int>(base - data) + count<true>(base, size, item);
+   }
+
+   /**
+    * Finds the first position whose element is greater than item, which is where a new
+    * copy of item belongs so that it lands after any equal elements.
+    * @param data The sorted buffer.
+    * @param size The number of elements in the buffer.
+    * @param item The item being placed.
+    * @param stats Receives the number of elements compared, counting every element of the final block.
+    * @return The index of the upper bound, or size if no element is greater than item.
+    */
+   template <typename DataType, typename Stats = NoStats>
+   static int upperBound(const DataType* data, int size, DataType item, Stats&& stats = Stats()) {
+      const DataType* base = data;
+      int probes = 0;
+      while (size > BLOCK) {
+         int half = size / 2;
+         prefetch(base + half / 2); // Next probe if we stay in the lower half
+         prefetch(base + half + half / 2); // Next probe if we move to the upper half
+         base = (item < base[half]) ? base : base + half;
+         size -= half;
+         ++probes;
+      }
+      stats.addProbes(probes + size);
+      return static_cast<int>(base - data) + size - count<false>(base, size, item);
+   }
+
+   /**
+    * Reports whether the CPU supports the AVX2 kernels. The answer is cached on first use.
+    * @return true if AVX2 is available, otherwise false.
+    */
+   static bool hasAvx2() {
+#if SIMD_SEARCH_X86
+      static const bool supported = __builtin_cpu_supports("avx2");
+      return supported;
+#else
+      return false;
+#endif
+   }
+
+private:
+   /**
+    * Hints that the cache line holding address will be read soon.
+    */
+   static void prefetch(const void* address) {
+#if SIMD_SEARCH_X86
+      __builtin_prefetch(address);
+#else
+      (void)address;
+#endif
+   }
+
+   /**
+    * Counts the elements that compare greater than the key (KeyFirst false) or that the key
+    * compares greater than (KeyFirst true), using the best kernel for DataType and this CPU.
+    */
+   template <bool KeyFirst, typename DataType>
+   static int count(const DataType* data, int size, DataType item) {
+#if SIMD_SEARCH_X86
+      if constexpr (hasVectorLanes<DataType>()) {
+         return hasAvx2() ? countAvx2<KeyFirst>(data, size, item) : countSse2<KeyFirst>(data, size, item);
+      }
+#endif
+      return countScalar<KeyFirst>(data, 0, size, item);
+   }
+
+   /**
+    * Reports whether DataType maps onto a vector lane the kernels know how to compare.
+    */
+   template <typename DataType>
+   static constexpr bool hasVectorLanes() {
+      return std::is_same<DataType, float>::value || std::is_same<DataType, double>::value ||
+             (std::is_integral<DataType>::value && std::is_signed<DataType>::value &&
+              (sizeof(DataType) == 4 || sizeof(DataType) == 8));
+   }
+
+   /**
+    * Scalar fallback, also used for the tail that does not fill a whole vector.
+    */
+   template <bool KeyFirst, typename DataType>
+   static int countScalar(const DataType* data, int from, int size, DataType item) {
+      int total = 0;
+      for (int i = from; i < size; ++i) {
+         total += (KeyFirst ? item > data[i] : data[i] > item) ? 1 : 0;
+      }
+      return total;
+   }
+
+#if SIMD_SEARCH_X86
+   template <bool KeyFirst, typename DataType>
+   SIMD_SEARCH_AVX2 static int countAvx2(const DataType* data, int size, DataType item) {
+      int total = 0;
+      int i = 0;
+      if constexpr (std::is_same<DataType, float>::value) {
+         __m256 key = _mm256_set1_ps(item);
+         for (; i + 8 <= size; i += 8) {
+            __m256 values = _mm256_loadu_ps(data + i);
+            __m256 greater = KeyFirst ? _mm256_cmp_ps(key, values, _CMP_GT_OQ) : _mm256_cmp_ps(values, key, _CMP_GT_OQ);
+            total += __builtin_popcount(_mm256_movemask_ps(greater));
+         }
+      } else if constexpr (std::is_same<DataType, double>::value) {
+         __m256d key = _mm256_set1_pd(item);
+         for (; i + 4 <= size; i += 4) {
+            __m256d values = _mm256_loadu_pd(data + i);
+            __m256d greater = KeyFirst ? _mm256_cmp_pd(key, values, _CMP_GT_OQ) : _mm256_cmp_pd(values, key, _CMP_GT_OQ);
+            total += __builtin_popcount(_mm256_movemask_pd(greater));
+         }
+      } else if constexpr (sizeof(DataType) == 4) {
+         __m256i key = _mm256_set1_epi32(static_cast<int>(item));
+         for (; i + 8 <= size; i += 8) {
+            __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i greater = KeyFirst ? _mm256_cmpgt_epi32(key, values) : _mm256_cmpgt_epi32(values, key);
+            total += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(greater)));
+         }
+      } else {
+         __m256i key = _mm256_set1_epi64x(static_cast<long long>(item));
+         for (; i + 4 <= size; i += 4) {
+            __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i greater = KeyFirst ? _mm256_cmpgt_epi64(key, values) : _mm256_cmpgt_epi64(values, key);
+            total += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(greater)));
+         }
+      }
+      return total + countScalar<KeyFirst>(data, i, size, item);
+   }
+
+   template <bool KeyFirst, typename DataType>
+   SIMD_SEARCH_SSE2 static int countSse2(const DataType* data, int size, DataType item) {
+      int total = 0;
+      int i = 0;
+      if constexpr (std::is_same<DataType, float>::value) {
+         __m128 key = _mm_set1_ps(item);
+         for (; i + 4 <= size; i += 4) {
+            __m128 values = _mm_loadu_ps(data + i);
+            __m128 greater = KeyFirst ? _mm_cmpgt_ps(key, values) : _mm_cmpgt_ps(values, key);
+            total += __builtin_popcount(_mm_movemask_ps(greater));
+         }
+      } else if constexpr (std::is_same<DataType, double>::value) {
+         __m128d key = _mm_set1_pd(item);
+         for (; i + 2 <= size; i += 2) {
+            __m128d values = _mm_loadu_pd(data + i);
+            __m128d greater = KeyFirst ? _mm_cmpgt_pd(key, values) : _mm_cmpgt_pd(values, key);
+            total += __builtin_popcount(_mm_movemask_pd(greater));
+         }
+      } else if constexpr (sizeof(DataType) == 4) {
+         __m128i key = _mm_set1_epi32(static_cast<int>(item));
+         for (; i + 4 <= size; i += 4) {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i greater = KeyFirst ? _mm_cmpgt_epi32(key, values) : _mm_cmpgt_epi32(values, key);
+            total += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(greater)));
+         }
+      }
+      return total + countScalar<KeyFirst>(data, i, size, item);
+   }
+#endif
+};
+
+#endif
@@ -0,0 +1,330 @@
+#include <new>
+#include <utility>
+#include "SkipADTList.h"
+
+// Constructor: Initializes an empty skip list
+template <class DataType>
+SkipADTList<DataType>::SkipADTList() {
+   for (int i = 0; i < MAX_LEVEL; ++i) {
+       heads[i] = nullptr; // Every level starts out empty
+   }
+   level = 1;
+   size = 0;
+   seed = 0x9E3779B9u; // Any nonzero seed works for the xorshift generator
+}
+
+// Destructor: Clears the list to free memory
+template <class DataType>
+SkipADTList<DataType>::~SkipADTList() {
+   clear();
+}
+
+// Copy Constructor: Creates a deep copy of another list
+template <class DataType>
+SkipADTList<DataType>::SkipADTList(const SkipADTList& other) : SkipADTList() {
+   deepCopy(other);
+}
+
+// Assignment Operator: Copies the other list aside, then swaps it in
+template <class DataType>
+SkipADTList<DataType>& SkipADTList<DataType>::operator=(const SkipADTList& other) {
+   if (this != &other) { // Check for self-assignment
+       SkipADTList copy(other);
+       swap(copy); // The old nodes are freed when copy goes out of scope
+   }
+   return *this;
+}
+
+// Move Constructor: Takes over the other list's nodes
+template <class DataType>
+SkipADTList<DataType>::SkipADTList(SkipADTList&& other) noexcept : SkipADTList() {
+   swap(other);
+}
+
+// Move Assignment Operator: Frees this list's nodes and takes over the other list's
+template <class DataType>
+SkipADTList<DataType>& SkipADTList<DataType>::operator=(SkipADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       clear();
+       swap(other); // The other list receives this list's empty state
+   }
+   return *this;
+}
+
+// Swap: Exchanges the nodes of this list with another list
+template <class DataType>
+void SkipADTList<DataType>::swap(SkipADTList& other) noexcept {
+   for (int i = 0; i < MAX_LEVEL; ++i) {
+       std::swap(heads[i], other.heads[i]);
+   }
+   std::swap(level, other.level);
+   std::swap(size, other.size);
+   std::swap(seed, other.seed);
+}
+
+// Get length: Returns the number of items in the list
+template <class DataType>
+int SkipADTList<DataType>::getLength() const {
+   return size;
+}
+
+// Insert item to the list: Copies the item into a new node
+template <class DataType>
+void SkipADTList<DataType>::putItem(const DataType& item) {
+   insertNode(createNode(randomHeight(), item));
+}
+
+// Insert item to the list: Moves the item into a new node
+template <class DataType>
+void SkipADTList<DataType>::putItem(DataType&& item) {
+   insertNode(createNode(randomHeight(), std::move(item)));
+}
+
+// Emplace item: Constructs the item inside a new node and inserts it
+template <class DataType>
+template <typename... Args>
+void SkipADTList<DataType>::emplaceItem(Args&&... args) {
+   insertNode(createNode(randomHeight(), std::forward<Args>(args)...));
+}
+
+// Retrieve an item: Descends the levels to the item's position and returns it if present
+template <class DataType>
+bool SkipADTList<DataType>::getItem(const DataType& item, DataType& found_item) const {
+   Node** update[MAX_LEVEL];
+   Node* candidate = findPosition(item, update);
+   if (candidate != nullptr && candidate->value == item) {
+       found_item = candidate->value;
+       return true;
+   }
+   return false;
+}
+
+// Lower bound: Descends the towers to the first value not less than item
+template <class DataType>
+typename SkipADTList<DataType>::Iterator SkipADTList<DataType>::lowerBound(const DataType& item) {
+   Node** update[MAX_LEVEL];
+   return Iterator(this, findPosition(item, update));
+}
+
+// Upper bound: Descends the towers to the first value greater than item
+template <class DataType>
+typename SkipADTList<DataType>::Iterator SkipADTList<DataType>::upperBound(const DataType& item) {
+   return Iterator(this, findGreater(item));
+}
+
+// Equal range: Descends once for each bound
+template <class DataType>
+std::pair<typename SkipADTList<DataType>::Iterator, typename SkipADTList<DataType>::Iterator>
+SkipADTList<DataType>::equalRange(const DataType& item) {
+   return std::make_pair(lowerBound(item), upperBound(item));
+}
+
+// Range iterator: Spans from the lower bound of lo to the upper bound of hi
+template <class DataType>
+IteratorRange<typename SkipADTList<DataType>::Iterator> SkipADTList<DataType>::rangeIterator(const DataType& lo, const DataType& hi) {
+   Iterator lower = lowerBound(lo);
+   return IteratorRange<Iterator>(lower, (hi < lo) ? lower : upperBound(hi));
+}
+
+// Make list empty: Clears the list by deleting all nodes
+template <class DataType>
+void SkipADTList<DataType>::makeEmpty() {
+   clear();
+}
+
+// Delete an item: Unlinks the node from each level of its tower and frees it
+template <class DataType>
+bool SkipADTList<DataType>::deleteItem(const DataType& item) {
+   Node** update[MAX_LEVEL];
+   Node* target = findPosition(item, update);
+   if (target == nullptr || target->value != item) { // If the item was not found
+       return false;
+   }
+   for (int i = 0; i < target->height; ++i) {
+       update[i][i] = target->next[i]; // Splice the node out of this level
+   }
+   destroyNode(target);
+   while (level > 1 && heads[level - 1] == nullptr) {
+       level--; // Drop levels that no longer hold any node
+   }
+   size--;
+   return true;
+}
+
+// Check if list is full: Always returns false for a skip list
+template <class DataType>
+bool SkipADTList<DataType>::isFull() const {
+   return false;
+}
+
+// Random height: Flips two-bit coins from an xorshift generator until one comes up nonzero
+template <class DataType>
+int SkipADTList<DataType>::randomHeight() {
+   int height = 1;
+   while (height < MAX_LEVEL) {
+       seed ^= seed << 13;
+       seed ^= seed >> 17;
+       seed ^= seed << 5;
+       if ((seed & 3u) != 0) {
+           break;
+       }
+       height++;
+   }
+   return height;
+}
+
+// Find position: Records the link array on every level that leads to the first value not less than item
+template <class DataType>
+typename SkipADTList<DataType>::Node* SkipADTList<DataType>::findPosition(const DataType& item, Node*** update) const {
+   Node** links = const_cast<Node**>(heads); // Links of the current predecessor, starting at the heads
+   for (int i = level - 1; i >= 0; --i) {
+       while (links[i] != nullptr && links[i]->value < item) {
+           links = links[i]->next; // Skip ahead along this level
+       }
+       update[i] = links;
+   }
+   return links[0];
+}
+
+// Find greater: Like findPosition, but also skips values equal to item
+template <class DataType>
+typename SkipADTList<DataType>::Node* SkipADTList<DataType>::findGreater(const DataType& item) const {
+   Node* const* links = heads;
+   for (int i = level - 1; i >= 0; --i) {
+       while (links[i] != nullptr && !(item < links[i]->value)) {
+           links = links[i]->next; // Skip ahead along this level
+       }
+   }
+   return links[0];
+}
+
+// Create node: Allocates the node and its tower in one block and constructs the value in place
+template <class DataType>
+template <typename... Args>
+typename SkipADTList<DataType>::Node* SkipADTList<DataType>::createNode(int height, Args&&... args) {
+   // sizeof(Node) is a multiple of its alignment, which covers the alignment of the tower pointers
+   void* storage = ::operator new(sizeof(Node) + height * sizeof(Node*));
+   Node** tower = reinterpret_cast<Node**>(static_cast<char*>(storage) + sizeof(Node));
+   try {
+       Node* node = new (storage) Node{DataType(std::forward<Args>(args)...), height, tower};
+       for (int i = 0; i < height; ++i) {
+           tower[i] = nullptr;
+       }
+       return node;
+   } catch (...) {
+       ::operator delete(storage); // Do not leak the storage if the value's constructor throws
+       throw;
+   }
+}
+
+// Destroy node: Runs the value's destructor and frees the node with its tower
+template <class DataType>
+void SkipADTList<DataType>::destroyNode(Node* node) {
+   node->~Node();
+   ::operator delete(node);
+}
+
+// Insert node: Splices the node in front of the first value not less than it on each level of its tower
+template <class DataType>
+void SkipADTList<DataType>::insertNode(Node* node) {
+   Node** update[MAX_LEVEL];
+   findPosition(node->value, update);
+   for (int i = level; i < node->height; ++i) {
+       update[i] = heads; // New levels start at the heads
+   }
+   if (node->height > level) {
+       level = node->height;
+   }
+   for (int i = 0; i < node->height; ++i) {
+       node->next[i] = update[i][i];
+       update[i][i] = node;
+   }
+   size++;
+}
+
+// Deep copy function: Copies the other list in order, giving each node the same tower height
+template <class DataType>
+void SkipADTList<DataType>::deepCopy(const SkipADTList& other) {
+   clear();
+   Node** tails[MAX_LEVEL]; // Link array to extend on each level
+   for (int i = 0; i < MAX_LEVEL; ++i) {
+       tails[i] = heads;
+   }
+   for (Node* other_curr = other.heads[0]; other_curr != nullptr; other_curr = other_curr->next[0]) {
+       Node* node = createNode(other_curr->height, other_curr->value);
+       for (int i = 0; i < node->height; ++i) {
+           tails[i][i] = node; // Append to the end of each level
+           tails[i] = node->next;
+       }
+       if (node->height > level) {
+           level = node->height; // Raised as each level is linked, so a partial copy stays consistent
+       }
+       size++;
+   }
+}
+
+// Clear the list: Deletes all nodes along the bottom level
+template <class DataType>
+void SkipADTList<DataType>::clear() {
+   Node* curr = heads[0];
+   while (curr != nullptr) {
+       Node* temp = curr;
+       curr = curr->next[0];
+       destroyNode(temp);
+   }
+   for (int i = 0; i < MAX_LEVEL; ++i) {
+       heads[i] = nullptr;
+   }
+   level = 1;
+   size = 0;
+}
+
+// Iterator Constructor: Initializes an iterator with a list and a node
+template <class DataType>
+SkipADTList<DataType>::Iterator::Iterator(SkipADTList* myList, Node* current) {
+   this->myList = myList;
+   this->current = current;
+}
+
+// Iterator Dereference Operator: Returns the value of the current node
+template <class DataType>
+const DataType& SkipADTList<DataType>::Iterator::operator*() const {
+   if (current == nullptr) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator is at the end of the list.");
+   }
+   return current->value;
+}
+
+// Iterator Pre-increment Operator: Moves the iterator to the next node on the bottom level
+template <class DataType>
+typename SkipADTList<DataType>::Iterator& SkipADTList<DataType>::Iterator::operator++() {
+   if (current == nullptr) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator is at the end of the list.");
+   }
+   current = current->next[0];
+   return *this;
+}
+
+// Iterator Equality Comparison: Checks if two iterators are equal
+template <class DataType>
+bool SkipADTList<DataType>::Iterator::operator==(const Iterator& other) const {
+   return (current == other.current);
+}
+
+// Iterator Inequality Comparison: Checks if two iterators are not equal
+template <class DataType>
+bool SkipADTList<DataType>::Iterator::operator!=(const Iterator& other) const {
+   return !(*this == other);
+}
+
+// Begin: Returns an iterator pointing to the first node in the list
+template <class DataType>
+typename SkipADTList<DataType>::Iterator SkipADTList<DataType>::begin() {
+   return Iterator(this, heads[0]);
+}
+
+// End: Returns an iterator pointing to one past the last node in the list
+template <class DataType>
+typename SkipADTList<DataType>::Iterator SkipADTList<DataType>::end() {
+   return Iterator(this, nullptr);
+}
@@ -0,0 +1,306 @@
+#ifndef SKIP_ADT_LIST_H
+#define SKIP_ADT_LIST_H
+#include <stdexcept>
+#include <utility>
+#include "IteratorRange.h"
+/**
+ * A skip list implementation of an Abstract Data Type (ADT) List.
+ *
+ * This class has the same interface as LinkedADTList, but every node also carries a
+ * randomly sized tower of express links. Searches, inserts, and deletes skip ahead along
+ * the upper levels and take expected O(log n) steps instead of walking every node, while
+ * an insert or delete still only relinks the one node involved.
+ *
+ * @param DataType The type of data stored in the list.
+ */
+template <class DataType>
+class SkipADTList {
+private:
+    static const int MAX_LEVEL = 32; // Enough levels for far more items than an int can count.
+
+    /**
+     * Node structure for storing data and a tower of next pointers.
+     * The tower lives in the same allocation, directly after the node.
+     */
+    struct Node {
+        DataType value;
+        int height;  // Number of levels this node is linked into.
+        Node** next; // next[i] is the following node on level i.
+    };
+
+    Node* heads[MAX_LEVEL]; // First node on each level.
+    int level;              // Number of levels currently in use.
+    int size;               // Tracks the number of elements in the list.
+    unsigned int seed;      // State of the generator used to pick tower heights.
+
+    /**
+     * Chooses a tower height, with each extra level a quarter as likely as the one below.
+     *
+     * @return A height between 1 and MAX_LEVEL.
+     */
+    int randomHeight();
+
+    /**
+     * Walks down from the top level to the position in front of the first value not less than item.
+     *
+     * @param item The value to locate.
+     * @param update Receives, for every level, the link array whose entry would point at item.
+     * @return The first node whose value is not less than item, or nullptr.
+     */
+    Node* findPosition(const DataType& item, Node*** update) const;
+
+    /**
+     * Walks down from the top level to the first node whose value is greater than item.
+     *
+     * @param item The value to compare against.
+     * @return The node found, or nullptr.
+     */
+    Node* findGreater(const DataType& item) const;
+
+    /**
+     * Allocates a node with the given height and constructs its value from the given arguments.
+     *
+     * @param height The number of levels the node will be linked into.
+     * @param args The arguments forwarded to the DataType constructor.
+     * @return The new node, not yet linked into the list.
+     */
+    template <typename... Args>
+    Node* createNode(int height, Args&&... args);
+
+    /**
+     * Destroys a node's value and frees its storage.
+     *
+     * @param node The node to free.
+     */
+    void destroyNode(Node* node);
+
+    /**
+     * Links an already constructed node into its sorted position on every level of its tower.
+     *
+     * @param node The node to insert.
+     */
+    void insertNode(Node* node);
+
+    /**
+     * Copies another list's contents into this one, keeping its tower heights.
+     *
+     * @param other The list to be copied.
+     */
+    void deepCopy(const SkipADTList& other);
+
+    /**
+     * Deallocates memory and resets the list.
+     */
+    void clear();
+
+public:
+    /**
+     * Constructs an empty skip list.
+     */
+    SkipADTList();
+
+    /**
+     * Destroys the list and releases allocated memory.
+     */
+    ~SkipADTList();
+
+    /**
+     * Constructs a copy of another skip list.
+     *
+     * @param other The list to duplicate.
+     */
+    SkipADTList(const SkipADTList& other);
+
+    /**
+     * Assigns another list's contents to this one.
+     *
+     * @param other The list to assign.
+     * @return A reference to this list.
+     */
+    SkipADTList& operator=(const SkipADTList& other);
+
+    /**
+     * Takes over another list's nodes without copying them.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     */
+    SkipADTList(SkipADTList&& other) noexcept;
+
+    /**
+     * Releases this list's nodes and takes over another list's.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     * @return A reference to this list.
+     */
+    SkipADTList& operator=(SkipADTList&& other) noexcept;
+
+    /**
+     * Exchanges the contents of this list with another in constant time.
+     *
+     * @param other The list to swap with.
+     */
+    void swap(SkipADTList& other) noexcept;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The current size of the list.
+     */
+    int getLength() const;
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into the new node.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Constructs an item directly inside a new node and adds it to the list.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     */
+    template <typename... Args>
+    void emplaceItem(Args&&... args);
+
+    /**
+     * Searches for an item in the list.
+     *
+     * @param item The value to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Empties the list, removing all elements.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete.
+     * @return True if deleted, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Always false since a skip list is dynamically allocated.
+     */
+    bool isFull() const;
+
+    /**
+     * Iterator class for traversing the list in sorted order along the bottom level. Items are
+     * read-only through it, since a write could break the sort order; change an item by
+     * deleting it and putting the new value.
+     */
+    class Iterator {
+    public:
+        /**
+         * Constructs an iterator for the list.
+         *
+         * @param myList The list being traversed.
+         * @param current Pointer to the current node.
+         */
+        Iterator(SkipADTList* myList, Node* current);
+
+        /**
+         * Accesses the value at the iterator's current position.
+         *
+         * @return Const reference to the stored data.
+         */
+        const DataType& operator*() const;
+
+        /**
+         * Moves the iterator to the next node.
+         *
+         * @return Reference to the updated iterator.
+         */
+        Iterator& operator++();
+
+        /**
+         * Compares two iterators for equality.
+         *
+         * @param other The iterator to compare against.
+         * @return True if both point to the same position, otherwise false.
+         */
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * Checks if two iterators are different.
+         *
+         * @param other The iterator to compare against.
+         * @return True if they differ, otherwise false.
+         */
+        bool operator!=(const Iterator& other) const;
+
+    private:
+        SkipADTList* myList; // Pointer to the skip list.
+        Node* current;       // Pointer to the current node.
+    };
+
+    /**
+     * Provides an iterator to the start of the list.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    Iterator begin();
+
+    /**
+     * Provides an iterator to the end of the list.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    Iterator end();
+
+    /**
+     * Finds the first item that is not less than the given item. Descends the towers
+     * in expected O(log n) steps.
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if every item is less.
+     */
+    Iterator lowerBound(const DataType& item);
+
+    /**
+     * Finds the first item that is greater than the given item. Descends the towers
+     * in expected O(log n) steps.
+     *
+     * @param item The value to compare against.
+     * @return An iterator at that item, or end() if no item is greater.
+     */
+    Iterator upperBound(const DataType& item);
+
+    /**
+     * Finds every item equal to the given item. Both bounds are found by
+     * descending the towers.
+     *
+     * @param item The value to compare against.
+     * @return The lowerBound and upperBound of item; they are equal if item is absent.
+     */
+    std::pair<Iterator, Iterator> equalRange(const DataType& item);
+
+    /**
+     * Provides the items between two bounds, inclusive, without copying them.
+     * Both bounds are found by descending the towers.
+     *
+     * @param lo The smallest item to include.
+     * @param hi The largest item to include.
+     * @return A range that can be used in a range-based for loop; empty if hi is less than lo.
+     */
+    IteratorRange<Iterator> rangeIterator(const DataType& lo, const DataType& hi);
+};
+
+#include "SkipADTList.cpp"
+
+#endif // SKIP_ADT_LIST_H
@@ -0,0 +1,329 @@
+#include <functional>
+#include <utility>
+#include "UnrolledADTList.h"
+
+// Constructor: Initializes an empty list
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>::UnrolledADTList() {
+   head = nullptr; // Set head to nullptr (empty list)
+   size = 0; // Initialize size to 0
+}
+
+// Destructor: Clears the list to free memory
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>::~UnrolledADTList() {
+   clear();
+}
+
+// Copy Constructor: Creates a deep copy of another list
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>::UnrolledADTList(const UnrolledADTList& other) {
+   head = nullptr;
+   size = 0;
+   deepCopy(other);
+}
+
+// Assignment Operator: Copies the other list aside, then swaps it in
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>& UnrolledADTList<DataType, NodeCapacity>::operator=(const UnrolledADTList& other) {
+   if (this != &other) { // Check for self-assignment
+       UnrolledADTList copy(other);
+       swap(copy); // The old nodes are freed when copy goes out of scope
+   }
+   return *this;
+}
+
+// Move Constructor: Takes over the other list's nodes
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>::UnrolledADTList(UnrolledADTList&& other) noexcept {
+   head = other.head;
+   size = other.size;
+   other.head = nullptr; // Leave the other list empty
+   other.size = 0;
+}
+
+// Move Assignment Operator: Frees this list's nodes and takes over the other list's
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>& UnrolledADTList<DataType, NodeCapacity>::operator=(UnrolledADTList&& other) noexcept {
+   if (this != &other) { // Check for self-assignment
+       clear();
+       head = other.head;
+       size = other.size;
+       other.head = nullptr; // Leave the other list empty
+       other.size = 0;
+   }
+   return *this;
+}
+
+// Swap: Exchanges the nodes of this list with another list
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::swap(UnrolledADTList& other) noexcept {
+   std::swap(head, other.head);
+   std::swap(size, other.size);
+}
+
+// Get length: Returns the number of items in the list
+template <class DataType, int NodeCapacity>
+int UnrolledADTList<DataType, NodeCapacity>::getLength() const {
+   return size;
+}
+
+// Insert item to the list: Copies the item into place
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::putItem(const DataType& item) {
+   insertItem(item);
+}
+
+// Insert item to the list: Moves the item into place
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::putItem(DataType&& item) {
+   insertItem(std::move(item));
+}
+
+// Emplace item: Constructs the item and moves it into place
+template <class DataType, int NodeCapacity>
+template <typename... Args>
+void UnrolledADTList<DataType, NodeCapacity>::emplaceItem(Args&&... args) {
+   insertItem(DataType(std::forward<Args>(args)...));
+}
+
+// Retrieve an item: Skips whole nodes by their last value, then scans the one node that could hold it
+template <class DataType, int NodeCapacity>
+bool UnrolledADTList<DataType, NodeCapacity>::getItem(const DataType& item, DataType& found_item) const {
+   Node* previous;
+   Node* node = findNode(item, &previous);
+   if (node == nullptr) { // The list is empty
+       return false;
+   }
+   int index = findIndex(node, item);
+   if (index < node->count && node->items[index] == item) {
+       found_item = node->items[index];
+       return true;
+   }
+   return false;
+}
+
+// Make list empty: Clears the list by deleting all nodes
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::makeEmpty() {
+   clear();
+}
+
+// Delete an item: Closes the gap inside its node, then refills the node if it is under half full
+template <class DataType, int NodeCapacity>
+bool UnrolledADTList<DataType, NodeCapacity>::deleteItem(const DataType& item) {
+   Node* previous;
+   Node* node = findNode(item, &previous);
+   if (node == nullptr) { // The list is empty
+       return false;
+   }
+   int index = findIndex(node, item);
+   if (index == node->count || node->items[index] != item) { // If the item was not found
+       return false;
+   }
+   for (int i = index; i < node->count - 1; ++i) {
+       node->items[i] = std::move(node->items[i + 1]); // Shift the rest of the node left
+   }
+   node->count--;
+   size--;
+   rebalance(node, previous);
+   return true;
+}
+
+// Check if list is full: Always returns false since nodes are allocated on demand
+template <class DataType, int NodeCapacity>
+bool UnrolledADTList<DataType, NodeCapacity>::isFull() const {
+   return false;
+}
+
+// Find node: Walks node by node until one ends at or after item, stopping at the last node
+template <class DataType, int NodeCapacity>
+typename UnrolledADTList<DataType, NodeCapacity>::Node* UnrolledADTList<DataType, NodeCapacity>::findNode(const DataType& item, Node** previous) const {
+   Node* prev = nullptr;
+   Node* curr = head;
+   while (curr != nullptr && curr->next != nullptr && curr->items[curr->count - 1] < item) {
+       prev = curr;
+       curr = curr->next;
+   }
+   *previous = prev;
+   return curr;
+}
+
+// Find index: Scans the node's items in order for the first one not less than item
+template <class DataType, int NodeCapacity>
+int UnrolledADTList<DataType, NodeCapacity>::findIndex(const Node* node, const DataType& item) {
+   int index = 0;
+   while (index < node->count && node->items[index] < item) {
+       index++;
+   }
+   return index;
+}
+
+// Insert item: Finds the target node, splits it in half if it is full, and shifts the item into place
+template <class DataType, int NodeCapacity>
+template <typename Item>
+void UnrolledADTList<DataType, NodeCapacity>::insertItem(Item&& item) {
+   if (head == nullptr) {
+       head = new Node;
+       head->count = 0;
+       head->next = nullptr;
+   }
+   Node* previous;
+   Node* node = findNode(item, &previous);
+   const DataType* address = &item;
+   if (std::less_equal<const DataType*>()(node->items, address) && std::less<const DataType*>()(address, node->items + NodeCapacity)) {
+       // Shifting or splitting moves the items of the node the item lives in, so copy it out first
+       DataType held(static_cast<const DataType&>(item));
+       insertItem(std::move(held));
+       return;
+   }
+   int index = findIndex(node, item);
+
+   if (node->count == NodeCapacity) { // No room left, so move the upper half to a new node
+       Node* sibling = new Node;
+       int keep = NodeCapacity / 2;
+       sibling->count = NodeCapacity - keep;
+       sibling->next = node->next;
+       for (int i = 0; i < sibling->count; ++i) {
+           sibling->items[i] = std::move(node->items[keep + i]);
+       }
+       node->count = keep;
+       node->next = sibling;
+       if (index > keep) { // The item belongs in the upper half
+           node = sibling;
+           index -= keep;
+       }
+   }
+
+   for (int i = node->count; i > index; --i) {
+       node->items[i] = std::move(node->items[i - 1]); // Shift larger items right within the node
+   }
+   node->items[index] = std::forward<Item>(item);
+   node->count++;
+   size++;
+}
+
+// Rebalance: Merges an under-full node with its successor, or borrows items from it
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::rebalance(Node* node, Node* previous) {
+   if (node->count >= NodeCapacity / 2) {
+       return; // Still at least half full
+   }
+   Node* next = node->next;
+   if (next != nullptr) {
+       if (node->count + next->count <= NodeCapacity) { // Both fit in one node
+           for (int i = 0; i < next->count; ++i) {
+               node->items[node->count + i] = std::move(next->items[i]);
+           }
+           node->count += next->count;
+           node->next = next->next;
+           delete next;
+       } else { // Borrow enough from the successor to even the two nodes out
+           int borrowed = (next->count - node->count) / 2;
+           for (int i = 0; i < borrowed; ++i) {
+               node->items[node->count + i] = std::move(next->items[i]);
+           }
+           for (int i = borrowed; i < next->count; ++i) {
+               next->items[i - borrowed] = std::move(next->items[i]);
+           }
+           node->count += borrowed;
+           next->count -= borrowed;
+       }
+   }
+   if (node->count == 0) { // Only the last node can end up empty
+       if (previous == nullptr) {
+           head = node->next;
+       } else {
+           previous->next = node->next;
+       }
+       delete node;
+   }
+}
+
+// Deep copy function: Copies the other list node by node, keeping the same fill
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::deepCopy(const UnrolledADTList& other) {
+   try {
+       Node** link = &head; // Where the next copied node gets attached
+       for (Node* other_curr = other.head; other_curr != nullptr; other_curr = other_curr->next) {
+           Node* node = new Node;
+           node->count = 0;
+           node->next = nullptr;
+           *link = node; // Linked before its items are copied, so clear() frees it if a copy throws
+           link = &node->next;
+           for (int i = 0; i < other_curr->count; ++i) {
+               node->items[i] = other_curr->items[i];
+           }
+           node->count = other_curr->count;
+       }
+   } catch (...) {
+       clear(); // Only called from the copy constructor, whose destructor will not run
+       throw;
+   }
+   size = other.size;
+}
+
+// Clear the list: Deletes all nodes in the list
+template <class DataType, int NodeCapacity>
+void UnrolledADTList<DataType, NodeCapacity>::clear() {
+   while (head != nullptr) {
+       Node* temp = head;
+       head = head->next;
+       delete temp;
+   }
+   size = 0;
+}
+
+// Iterator Constructor: Initializes an iterator with a list, a node, and a position within it
+template <class DataType, int NodeCapacity>
+UnrolledADTList<DataType, NodeCapacity>::Iterator::Iterator(UnrolledADTList* myList, Node* current, int index) {
+   this->myList = myList;
+   this->current = current;
+   this->index = index;
+}
+
+// Iterator Dereference Operator: Returns the item at the current position
+template <class DataType, int NodeCapacity>
+const DataType& UnrolledADTList<DataType, NodeCapacity>::Iterator::operator*() const {
+   if (current == nullptr) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator is at the end of the list.");
+   }
+   return current->items[index];
+}
+
+// Iterator Pre-increment Operator: Advances within the node, then on to the next node
+template <class DataType, int NodeCapacity>
+typename UnrolledADTList<DataType, NodeCapacity>::Iterator& UnrolledADTList<DataType, NodeCapacity>::Iterator::operator++() {
+   if (current == nullptr) { // Check if the iterator is at the end
+       throw std::out_of_range("Iterator is at the end of the list.");
+   }
+   if (++index == current->count) {
+       current = current->next;
+       index = 0;
+   }
+   return *this;
+}
+
+// Iterator Equality Comparison: Checks if two iterators are equal
+template <class DataType, int NodeCapacity>
+bool UnrolledADTList<DataType, NodeCapacity>::Iterator::operator==(const Iterator& other) const {
+   return (current == other.current && index == other.index);
+}
+
+// Iterator Inequality Comparison: Checks if two iterators are not equal
+template <class DataType, int NodeCapacity>
+bool UnrolledADTList<DataType, NodeCapacity>::Iterator::operator!=(const Iterator& other) const {
+   return !(*this == other);
+}
+
+// Begin: Returns an iterator pointing to the first item in the list
+template <class DataType, int NodeCapacity>
+typename UnrolledADTList<DataType, NodeCapacity>::Iterator UnrolledADTList<DataType, NodeCapacity>::begin() {
+   return Iterator(this, head, 0);
+}
+
+// End: Returns an iterator pointing past the last item in the list
+template <class DataType, int NodeCapacity>
+typename UnrolledADTList<DataType, NodeCapacity>::Iterator UnrolledADTList<DataType, NodeCapacity>::end() {
+   return Iterator(this, nullptr, 0);
+}
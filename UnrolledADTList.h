@@ -0,0 +1,254 @@
+#ifndef UNROLLED_ADT_LIST_H
+#define UNROLLED_ADT_LIST_H
+#include <stdexcept>
+/**
+ * An unrolled linked list implementation of an Abstract Data Type (ADT) List.
+ *
+ * This class has the same interface as LinkedADTList, but each node holds a small sorted
+ * array of up to NodeCapacity items instead of a single one. Walks follow one pointer per
+ * node and scan items within a node sequentially, so traversal runs at close to array speed,
+ * while inserts and deletes still only shift items inside one node. Full nodes are split in
+ * half; nodes that fall below half full borrow from or merge with their successor.
+ *
+ * @param DataType The type of data stored in the list; it must be default constructible.
+ * @param NodeCapacity The number of items per node. The default fills about two cache lines.
+ */
+template <class DataType, int NodeCapacity = (sizeof(DataType) >= 32 ? 4 : 128 / static_cast<int>(sizeof(DataType)))>
+class UnrolledADTList {
+    static_assert(NodeCapacity >= 2, "UnrolledADTList needs room for at least two items per node");
+
+private:
+    /**
+     * Node structure for storing a sorted run of items and the next pointer.
+     */
+    struct Node {
+        int count;                      // Number of items in use.
+        Node* next;                     // Pointer to the following node.
+        DataType items[NodeCapacity];   // The items, sorted, in items[0..count).
+    };
+
+    Node* head; // Pointer to the first node in the list.
+    int size;   // Tracks the number of elements in the list.
+
+    /**
+     * Finds the node that holds, or would hold, the first value not less than item.
+     *
+     * @param item The value to locate.
+     * @param previous Receives the node before the returned one, or nullptr.
+     * @return The node to search or insert into, or nullptr if the list is empty.
+     */
+    Node* findNode(const DataType& item, Node** previous) const;
+
+    /**
+     * Finds the first position in a node whose value is not less than item.
+     *
+     * @param node The node to scan.
+     * @param item The value to locate.
+     * @return An index in [0, node->count].
+     */
+    static int findIndex(const Node* node, const DataType& item);
+
+    /**
+     * Places an item into its sorted position, splitting the target node if it is full.
+     *
+     * @param item The item to insert, copied or moved depending on how it was passed.
+     */
+    template <typename Item>
+    void insertItem(Item&& item);
+
+    /**
+     * Refills a node that has dropped below half full from its successor.
+     *
+     * @param node The node to rebalance.
+     * @param previous The node before it, or nullptr if it is the head.
+     */
+    void rebalance(Node* node, Node* previous);
+
+    /**
+     * Copies another list's contents into this one, which must be empty. If a copy throws, the
+     * nodes copied so far are freed before the exception propagates.
+     *
+     * @param other The list to be copied.
+     */
+    void deepCopy(const UnrolledADTList& other);
+
+    /**
+     * Deallocates memory and resets the list.
+     */
+    void clear();
+
+public:
+    /**
+     * Constructs an empty list.
+     */
+    UnrolledADTList();
+
+    /**
+     * Destroys the list and releases allocated memory.
+     */
+    ~UnrolledADTList();
+
+    /**
+     * Constructs a copy of another list.
+     *
+     * @param other The list to duplicate.
+     */
+    UnrolledADTList(const UnrolledADTList& other);
+
+    /**
+     * Assigns another list's contents to this one.
+     *
+     * @param other The list to assign.
+     * @return A reference to this list.
+     */
+    UnrolledADTList& operator=(const UnrolledADTList& other);
+
+    /**
+     * Takes over another list's nodes without copying them.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     */
+    UnrolledADTList(UnrolledADTList&& other) noexcept;
+
+    /**
+     * Releases this list's nodes and takes over another list's.
+     *
+     * @param other The list to take the contents of; it is left empty.
+     * @return A reference to this list.
+     */
+    UnrolledADTList& operator=(UnrolledADTList&& other) noexcept;
+
+    /**
+     * Exchanges the contents of this list with another in constant time.
+     *
+     * @param other The list to swap with.
+     */
+    void swap(UnrolledADTList& other) noexcept;
+
+    /**
+     * Retrieves the number of elements in the list.
+     *
+     * @return The current size of the list.
+     */
+    int getLength() const;
+
+    /**
+     * Adds an item to the list.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(const DataType& item);
+
+    /**
+     * Adds an item to the list, moving it into place.
+     *
+     * @param item The value to insert.
+     */
+    void putItem(DataType&& item);
+
+    /**
+     * Constructs an item from the given arguments and adds it to the list.
+     *
+     * @param args The arguments forwarded to the DataType constructor.
+     */
+    template <typename... Args>
+    void emplaceItem(Args&&... args);
+
+    /**
+     * Searches for an item in the list.
+     *
+     * @param item The value to find.
+     * @param found_item Stores the located item if found.
+     * @return True if found, otherwise false.
+     */
+    bool getItem(const DataType& item, DataType& found_item) const;
+
+    /**
+     * Empties the list, removing all elements.
+     */
+    void makeEmpty();
+
+    /**
+     * Removes a specified item from the list.
+     *
+     * @param item The value to delete.
+     * @return True if deleted, otherwise false.
+     */
+    bool deleteItem(const DataType& item);
+
+    /**
+     * Determines if the list is full.
+     *
+     * @return Always false since the nodes are dynamically allocated.
+     */
+    bool isFull() const;
+
+    /**
+     * Iterator class for traversing the list. Items are read-only through it, since a write
+     * could break the sort order; change an item by deleting it and putting the new value.
+     */
+    class Iterator {
+    public:
+        /**
+         * Constructs an iterator for the list.
+         *
+         * @param myList The list being traversed.
+         * @param current Pointer to the current node.
+         * @param index Position of the current item within the node.
+         */
+        Iterator(UnrolledADTList* myList, Node* current, int index);
+
+        /**
+         * Accesses the value at the iterator's current position.
+         *
+         * @return Const reference to the stored data.
+         */
+        const DataType& operator*() const;
+
+        /**
+         * Moves the iterator to the next item, crossing into the next node when needed.
+         *
+         * @return Reference to the updated iterator.
+         */
+        Iterator& operator++();
+
+        /**
+         * Compares two iterators for equality.
+         *
+         * @param other The iterator to compare against.
+         * @return True if both point to the same position, otherwise false.
+         */
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * Checks if two iterators are different.
+         *
+         * @param other The iterator to compare against.
+         * @return True if they differ, otherwise false.
+         */
+        bool operator!=(const Iterator& other) const;
+
+    private:
+        UnrolledADTList* myList; // Pointer to the list.
+        Node* current;           // Pointer to the current node.
+        int index;               // Position within the current node.
+    };
+
+    /**
+     * Provides an iterator to the start of the list.
+     *
+     * @return Iterator pointing to the first element.
+     */
+    Iterator begin();
+
+    /**
+     * Provides an iterator to the end of the list.
+     *
+     * @return Iterator pointing past the last element.
+     */
+    Iterator end();
+};
+
+#include "UnrolledADTList.cpp"
+
+#endif // UNROLLED_ADT_LIST_H